@@ -0,0 +1,173 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "simd.hpp"
+#include "stats.hpp"
+#include "tokenizer.hpp"
+
+// Tokenizes many short lines together. The lines are packed one after the
+// other (each followed by '\n') into a shared buffer, which is classified 64
+// bytes at a time into per-class bitmasks by the vector kernel. Pure ASCII
+// lines are then lexed straight from the bitmasks, with runs skipped by
+// counting bits and no per-line setup; lines with other bytes fall back to
+// the regular scanner. All tokens go into one shared array.
+struct token_batch {
+    struct token_range {
+        const token* first;
+        const token* last;
+
+        const token* begin() const { return first; }
+        const token* end() const { return last; }
+        size_t size() const { return last - first; }
+    };
+
+    // Tokens of every line, each line ending with its end of line token.
+    // Positions point into the caller's lines.
+    std::vector<token> tokens;
+    // Line i's tokens are [line_tokens[i], line_tokens[i + 1]).
+    std::vector<size_t> line_tokens;
+
+    // Reused between batches
+    std::unique_ptr<char[]> packed;
+    size_t packed_capacity = 0;
+    std::vector<size_t> line_starts;
+    std::vector<block_classes> classes;
+
+    size_t line_count() const {
+        return line_tokens.empty() ? 0 : line_tokens.size() - 1;
+    }
+
+    token_range line(size_t index) const {
+        assert(index < line_count());
+        return {tokens.data() + line_tokens[index], tokens.data() + line_tokens[index + 1]};
+    }
+
+    void tokenize(const std::string_view* lines, size_t count) {
+        tokens.clear();
+        line_tokens.assign(1, 0);
+        line_starts.clear();
+        if (count == 0)
+            return;
+
+        size_t packed_length = 0;
+        for (size_t i = 0; i < count; i++) {
+            line_starts.push_back(packed_length);
+            packed_length += lines[i].length() + 1;
+        }
+        size_t block_count = (packed_length + 63) / 64;
+        if (block_count * 64 > packed_capacity) {
+            packed_capacity = block_count * 64 * 2;
+            packed = std::make_unique<char[]>(packed_capacity);
+        }
+        for (size_t i = 0; i < count; i++) {
+            std::memcpy(packed.get() + line_starts[i], lines[i].data(), lines[i].length());
+            packed[line_starts[i] + lines[i].length()] = '\n';
+        }
+        std::memset(packed.get() + packed_length, 0, block_count * 64 - packed_length);
+
+        classes.resize(block_count);
+        const auto &kernels = simd();
+        for (size_t block = 0; block < block_count; block++)
+            kernels.classify_block(packed.get() + block * 64, classes[block]);
+
+        for (size_t i = 0; i < count; i++) {
+            size_t start = line_starts[i];
+            size_t end = start + lines[i].length();
+            // The scanner counts the bytes of non-ASCII lines itself
+            if (any_set(&block_classes::non_ascii, start, end)) {
+                auto tokenizer = tokenizer::from_line(std::string_view(packed.get() + start, end - start));
+                ::tokenize(tokenizer, [&](const token &next_token) {
+                    tokens.push_back(next_token);
+                    tokens.back().position = lines[i].data() + (next_token.position - (packed.get() + start));
+                });
+            }
+            else {
+                TOKENIZER_STAT_ADD(stat_bytes_scanned, end - start);
+                lex_ascii_line(lines[i].data(), start, end);
+            }
+            line_tokens.push_back(tokens.size());
+        }
+    }
+
+    void tokenize(const std::vector<std::string_view> &lines) {
+        tokenize(lines.data(), lines.size());
+    }
+
+    bool has(uint64_t block_classes::*mask, size_t position) const {
+        return (classes[position / 64].*mask >> (position % 64)) & 1;
+    }
+
+    // Whether any bit of `mask` is set in packed bytes [start, end).
+    bool any_set(uint64_t block_classes::*mask, size_t start, size_t end) const {
+        while (start < end) {
+            uint64_t bits = classes[start / 64].*mask >> (start % 64);
+            size_t in_block = 64 - start % 64;
+            if (end - start < in_block)
+                bits &= (uint64_t(1) << (end - start)) - 1;
+            if (bits != 0)
+                return true;
+            start += in_block;
+        }
+        return false;
+    }
+
+    // First packed byte at or after `position` outside `mask`. The zero
+    // padding after the last line is in no class, so this always stops.
+    size_t run_end(uint64_t block_classes::*mask, size_t position) const {
+        while (true) {
+            uint64_t outside = ~(classes[position / 64].*mask) >> (position % 64);
+            if (outside != 0)
+                return position + __builtin_ctzll(outside);
+            position += 64 - position % 64;
+        }
+    }
+
+    // Same tokens as the scanner gives for a line without multibyte
+    // characters, where every byte is one column.
+    void lex_ascii_line(const char* line, size_t start, size_t end) {
+        const char* text = packed.get();
+        auto emit = [&](token::kind_type kind, size_t position, size_t length) {
+            size_t column = position - start + 1;
+            tokens.push_back({kind, line + (position - start), length, column, length});
+            TOKENIZER_STAT_ADD(stat_tokens + size_t(kind), 1);
+        };
+
+        size_t position = run_end(&block_classes::space, start);
+        while (position < end) {
+            size_t token_start = position;
+            switch (text[position]) {
+                case '(':
+                case ')':
+                case '+':
+                case '-':
+                case '*':
+                case '/':
+                case '=':
+                    emit(token::punctuation_kind, position, 1);
+                    position++;
+                    break;
+                default:
+                    if (has(&block_classes::digit, position) || text[position] == '.') {
+                        // Never crosses `end`: the '\n' after the line is not a digit or '.'
+                        position = run_end(&block_classes::digit, position);
+                        if (text[position] == '.')
+                            position = run_end(&block_classes::digit, position + 1);
+                        emit(token::number_kind, token_start, position - token_start);
+                    }
+                    else if (has(&block_classes::identifier, position)) {
+                        position = run_end(&block_classes::identifier, position);
+                        emit(token::symbol_kind, token_start, position - token_start);
+                    }
+                    else {
+                        emit(token::bad_char_kind, position, 1);
+                        position++;
+                    }
+            }
+            position = run_end(&block_classes::space, position);
+        }
+        emit(token::eol_kind, end, 1);
+    }
+};
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <charconv>
+#include <string>
+#include <vector>
+
+#include "expression.hpp"
+
+// Stack bytecode for the calculator language. A program is compiled once from
+// the expression tree and then evaluated over whole columns of variable
+// values, one instruction at a time per batch of rows.
+struct instruction {
+    enum opcode : uint8_t {
+        push_constant,  // operand: index into program::constants
+        load_variable,  // operand: variable slot
+        store_variable, // operand: variable slot, value stays on the stack
+        negate,
+        add,
+        subtract,
+        multiply,
+        divide
+    } op;
+    uint32_t operand = 0;
+};
+
+struct program {
+    std::vector<instruction> code;
+    std::vector<double> constants;
+    std::vector<std::string> variables; // Slot to name, in order of first use
+    size_t max_stack = 0;
+
+    uint32_t variable_slot(std::string_view name) {
+        for (size_t slot = 0; slot < variables.size(); slot++)
+            if (variables[slot] == name)
+                return uint32_t(slot);
+        variables.emplace_back(name);
+        return uint32_t(variables.size() - 1);
+    }
+};
+
+struct program_compiler {
+    const expression_arena &arena;
+    program &output;
+    size_t stack_depth = 0;
+
+    void emit(instruction::opcode op, uint32_t operand, int stack_change) {
+        output.code.push_back({op, operand});
+        stack_depth += stack_change;
+        if (stack_depth > output.max_stack)
+            output.max_stack = stack_depth;
+    }
+
+    // Emits code leaving the value of the node on top of the stack.
+    bool compile(uint32_t index) {
+        const auto &node = arena[index];
+        switch (node.kind) {
+            case expression_node::number_node: {
+                double value = 0;
+                auto result = std::from_chars(node.position, node.position + node.length, value);
+                if (result.ec != std::errc() || result.ptr != node.position + node.length)
+                    return false;
+                output.constants.push_back(value);
+                emit(instruction::push_constant, uint32_t(output.constants.size() - 1), +1);
+                return true;
+            }
+            case expression_node::symbol_node:
+                emit(instruction::load_variable, output.variable_slot(node.string_view()), +1);
+                return true;
+            case expression_node::negate_node:
+                if (!compile(node.lhs))
+                    return false;
+                emit(instruction::negate, 0, 0);
+                return true;
+            case expression_node::assign_node: {
+                uint32_t slot = output.variable_slot(arena[node.lhs].string_view());
+                if (!compile(node.rhs))
+                    return false;
+                emit(instruction::store_variable, slot, 0);
+                return true;
+            }
+            default:
+                break;
+        }
+
+        if (!compile(node.lhs) || !compile(node.rhs))
+            return false;
+        switch (node.kind) {
+            case expression_node::add_node:      emit(instruction::add, 0, -1); break;
+            case expression_node::subtract_node: emit(instruction::subtract, 0, -1); break;
+            case expression_node::multiply_node: emit(instruction::multiply, 0, -1); break;
+            case expression_node::divide_node:   emit(instruction::divide, 0, -1); break;
+            default: return false;
+        }
+        return true;
+    }
+};
+
+// Parses and compiles `source`. Returns nullptr on success, otherwise an error
+// message. The program owns its variable names and may outlive `source`.
+const char* compile_program(const std::string &source, program &output) {
+    expression_arena arena;
+    expression_parser parser(tokenizer::from_string(source), arena);
+    uint32_t root = parser.parse();
+    if (root == expression_node::no_node)
+        return parser.error;
+
+    output = {};
+    program_compiler compiler = {arena, output};
+    if (!compiler.compile(root))
+        return "bad number literal";
+    return nullptr;
+}
+
+// Runs `prg` over `rows` rows. columns[slot] holds the values of variable
+// `slot` and receives the stored values of assigned variables. The value of
+// the whole expression is written to `result` when it is not null.
+//
+// Optimization(sorgre): Each instruction runs over a batch of rows in a flat
+// loop, which the compiler vectorizes. Variables are read in place, so only
+// computed values use the scratch stack.
+void evaluate(const program &prg, double* const* columns, size_t rows, double* result = nullptr) {
+    static const size_t batch_size = 256;
+
+    std::vector<double> scratch(prg.max_stack * batch_size);
+    std::vector<double> constants(prg.constants.size() * batch_size);
+    for (size_t c = 0; c < prg.constants.size(); c++)
+        for (size_t i = 0; i < batch_size; i++)
+            constants[c * batch_size + i] = prg.constants[c];
+
+    std::vector<const double*> stack(prg.max_stack);
+
+    for (size_t first = 0; first < rows; first += batch_size) {
+        size_t n = rows - first < batch_size ? rows - first : batch_size;
+        size_t top = 0;
+
+        for (const auto &ins : prg.code) {
+            double* out = nullptr;
+            switch (ins.op) {
+                case instruction::push_constant:
+                    stack[top++] = constants.data() + ins.operand * batch_size;
+                    continue;
+                case instruction::load_variable:
+                    stack[top++] = columns[ins.operand] + first;
+                    continue;
+                case instruction::store_variable: {
+                    double* column = columns[ins.operand] + first;
+                    // Values loaded from the column before the store keep
+                    // their old rows: move them to their scratch slots.
+                    for (size_t depth = 0; depth + 1 < top; depth++) {
+                        if (stack[depth] != column)
+                            continue;
+                        double* saved = scratch.data() + depth * batch_size;
+                        for (size_t i = 0; i < n; i++)
+                            saved[i] = column[i];
+                        stack[depth] = saved;
+                    }
+                    const double* value = stack[top - 1];
+                    if (value != column)
+                        for (size_t i = 0; i < n; i++)
+                            column[i] = value[i];
+                    stack[top - 1] = column;
+                    continue;
+                }
+                case instruction::negate: {
+                    const double* a = stack[top - 1];
+                    out = scratch.data() + (top - 1) * batch_size;
+                    for (size_t i = 0; i < n; i++)
+                        out[i] = -a[i];
+                    stack[top - 1] = out;
+                    continue;
+                }
+                default:
+                    break;
+            }
+
+            const double* a = stack[top - 2];
+            const double* b = stack[top - 1];
+            out = scratch.data() + (top - 2) * batch_size;
+            switch (ins.op) {
+                case instruction::add:
+                    for (size_t i = 0; i < n; i++) out[i] = a[i] + b[i];
+                    break;
+                case instruction::subtract:
+                    for (size_t i = 0; i < n; i++) out[i] = a[i] - b[i];
+                    break;
+                case instruction::multiply:
+                    for (size_t i = 0; i < n; i++) out[i] = a[i] * b[i];
+                    break;
+                case instruction::divide:
+                    for (size_t i = 0; i < n; i++) out[i] = a[i] / b[i];
+                    break;
+                default:
+                    assert(false);
+            }
+            top--;
+            stack[top - 1] = out;
+        }
+
+        assert(top == 1);
+        if (result != nullptr && stack[0] != result + first)
+            for (size_t i = 0; i < n; i++)
+                result[first + i] = stack[0][i];
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <type_traits>
+
+// From C++20 on the scanner is constexpr, so literals can be tokenized by the
+// compiler. During constant evaluation it skips statistics, probes and the
+// vector kernels, which only exist at run time. Before C++20 it is plain
+// run-time code.
+#ifdef __cpp_lib_is_constant_evaluated
+#define TOKENIZER_CONSTEXPR constexpr
+#else
+#define TOKENIZER_CONSTEXPR
+#endif
+
+constexpr bool constant_evaluation() {
+#ifdef __cpp_lib_is_constant_evaluated
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
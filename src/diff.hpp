@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "hash.hpp"
+#include "tokenizer.hpp"
+
+// A token of a whole text, with its line, for diffing. Whitespace is not
+// part of any token, so changes in spacing or line breaks do not show up.
+struct diff_token {
+    token::kind_type kind;
+    std::string_view spelling;
+    size_t line;
+    size_t column;
+    uint64_t key; // Hash of kind and spelling
+};
+
+// Tokens of every line in `text`, which must end with '\n'. End of line
+// tokens are left out.
+std::vector<diff_token> diff_tokens(std::string_view text) {
+    std::vector<diff_token> result;
+    size_t line = 1;
+    for (; !text.empty(); line++) {
+        size_t line_end = text.find('\n');
+        assert(line_end != std::string_view::npos);
+        auto tokenizer = tokenizer::from_line(text.substr(0, line_end));
+        tokenize<token::all_kinds_mask & ~token::mask_of(token::eol_kind)>(tokenizer, [&](const token &next_token) {
+            auto spelling = next_token.string_view();
+            result.push_back({next_token.kind, spelling, line, next_token.column, hash_bytes(spelling, next_token.kind)});
+        });
+        text.remove_prefix(line_end + 1);
+    }
+    return result;
+}
+
+// Shortest edit script between two key arrays, with Myers' linear space
+// refinement: find the middle snake of an optimal path with a forward and a
+// backward search, then solve both halves. Common prefixes and suffixes are
+// trimmed before every search.
+struct myers_diff {
+    const uint64_t* a;
+    const uint64_t* b;
+    std::vector<bool> deleted;  // Per a key
+    std::vector<bool> inserted; // Per b key
+    std::vector<ptrdiff_t> forward;
+    std::vector<ptrdiff_t> backward;
+
+    myers_diff(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b)
+        : a(a.data()), b(b.data()), deleted(a.size()), inserted(b.size()) {
+        size_t size = 2 * (a.size() + b.size()) + 3;
+        forward.resize(size);
+        backward.resize(size);
+        solve(0, a.size(), 0, b.size());
+    }
+
+    void solve(size_t a_first, size_t a_last, size_t b_first, size_t b_last) {
+        while (a_first < a_last && b_first < b_last && a[a_first] == b[b_first]) {
+            a_first++;
+            b_first++;
+        }
+        while (a_first < a_last && b_first < b_last && a[a_last - 1] == b[b_last - 1]) {
+            a_last--;
+            b_last--;
+        }
+        if (a_first == a_last || b_first == b_last) {
+            for (size_t i = a_first; i < a_last; i++)
+                deleted[i] = true;
+            for (size_t j = b_first; j < b_last; j++)
+                inserted[j] = true;
+            return;
+        }
+
+        size_t x, y;
+        middle_snake(a_first, a_last, b_first, b_last, x, y);
+        solve(a_first, x, b_first, y);
+        solve(x, a_last, y, b_last);
+    }
+
+    // Sets (x, y) to a point on an optimal path that splits the edits in
+    // about half. Diagonal k holds points with x - y == k; forward[] keeps the
+    // furthest x reached from the start on each diagonal, backward[] the
+    // furthest distance reached from the end, -1 where not reached yet.
+    // Diagonals that run off the edit graph are dropped from the search.
+    void middle_snake(size_t a_first, size_t a_last, size_t b_first, size_t b_last, size_t &x_split, size_t &y_split) {
+        const uint64_t* a_part = a + a_first;
+        const uint64_t* b_part = b + b_first;
+        ptrdiff_t n = a_last - a_first;
+        ptrdiff_t m = b_last - b_first;
+        ptrdiff_t max_d = (n + m + 1) / 2;
+        ptrdiff_t offset = max_d;
+        ptrdiff_t length = 2 * max_d;
+        std::fill(forward.begin(), forward.begin() + length + 2, -1);
+        std::fill(backward.begin(), backward.begin() + length + 2, -1);
+        forward[offset + 1] = 0;
+        backward[offset + 1] = 0;
+        ptrdiff_t delta = n - m;
+        bool odd = delta & 1;
+        ptrdiff_t forward_start = 0, forward_end = 0;
+        ptrdiff_t backward_start = 0, backward_end = 0;
+
+        for (ptrdiff_t d = 0; d < max_d; d++) {
+            for (ptrdiff_t k = -d + forward_start; k <= d - forward_end; k += 2) {
+                ptrdiff_t x = (k == -d || (k != d && forward[offset + k - 1] < forward[offset + k + 1]))
+                    ? forward[offset + k + 1]
+                    : forward[offset + k - 1] + 1;
+                ptrdiff_t y = x - k;
+                while (x < n && y < m && a_part[x] == b_part[y]) {
+                    x++;
+                    y++;
+                }
+                forward[offset + k] = x;
+                if (x > n) {
+                    forward_end += 2;
+                }
+                else if (y > m) {
+                    forward_start += 2;
+                }
+                else if (odd) {
+                    ptrdiff_t reverse = offset + delta - k;
+                    if (reverse >= 0 && reverse < length && backward[reverse] != -1 && x >= n - backward[reverse]) {
+                        x_split = a_first + x;
+                        y_split = b_first + y;
+                        return;
+                    }
+                }
+            }
+            for (ptrdiff_t k = -d + backward_start; k <= d - backward_end; k += 2) {
+                ptrdiff_t x = (k == -d || (k != d && backward[offset + k - 1] < backward[offset + k + 1]))
+                    ? backward[offset + k + 1]
+                    : backward[offset + k - 1] + 1;
+                ptrdiff_t y = x - k;
+                while (x < n && y < m && a_part[n - 1 - x] == b_part[m - 1 - y]) {
+                    x++;
+                    y++;
+                }
+                backward[offset + k] = x;
+                if (x > n) {
+                    backward_end += 2;
+                }
+                else if (y > m) {
+                    backward_start += 2;
+                }
+                else if (!odd) {
+                    ptrdiff_t reverse = offset + delta - k;
+                    if (reverse >= 0 && reverse < length && forward[reverse] != -1 && forward[reverse] >= n - x) {
+                        x_split = a_first + forward[reverse];
+                        y_split = b_first + forward[reverse] - (reverse - offset);
+                        return;
+                    }
+                }
+            }
+        }
+        // No common key at all: delete everything, then insert everything
+        x_split = a_last;
+        y_split = b_first;
+    }
+};
+
+// Token-level differences between an old (a) and a new (b) token list. A
+// deleted run whose tokens are inserted unchanged somewhere else is reported
+// once, as moved.
+struct token_diff {
+    struct hunk {
+        enum kind_type {
+            deleted,  // a[first, last)
+            inserted, // b[to_first, to_last)
+            moved     // a[first, last) reappears as b[to_first, to_last)
+        } kind;
+        size_t first, last;
+        size_t to_first, to_last;
+    };
+
+    std::vector<hunk> hunks;
+
+    static token_diff of(const std::vector<diff_token> &a, const std::vector<diff_token> &b) {
+        std::vector<uint64_t> a_keys, b_keys;
+        for (const auto &tkn : a)
+            a_keys.push_back(tkn.key);
+        for (const auto &tkn : b)
+            b_keys.push_back(tkn.key);
+        myers_diff script(a_keys, b_keys);
+
+        token_diff result;
+        size_t i = 0, j = 0;
+        while (i < a.size() || j < b.size()) {
+            if (i < a.size() && j < b.size() && !script.deleted[i] && !script.inserted[j]) {
+                i++;
+                j++;
+                continue;
+            }
+            size_t first = i, to_first = j;
+            while (i < a.size() && script.deleted[i])
+                i++;
+            while (j < b.size() && script.inserted[j])
+                j++;
+            if (i != first)
+                result.hunks.push_back({hunk::deleted, first, i, 0, 0});
+            if (j != to_first)
+                result.hunks.push_back({hunk::inserted, 0, 0, to_first, j});
+        }
+        result.find_moves(a_keys, b_keys);
+        return result;
+    }
+
+    // Pairs each deleted run with an inserted run of the same tokens.
+    void find_moves(const std::vector<uint64_t> &a_keys, const std::vector<uint64_t> &b_keys) {
+        auto run_key = [](const uint64_t* keys, size_t first, size_t last) {
+            uint64_t key = last - first;
+            for (size_t i = first; i < last; i++)
+                key = hash_mix(key ^ keys[i]);
+            return key;
+        };
+        std::unordered_multimap<uint64_t, size_t> insertions;
+        for (size_t h = 0; h < hunks.size(); h++) {
+            if (hunks[h].kind == hunk::inserted)
+                insertions.emplace(run_key(b_keys.data(), hunks[h].to_first, hunks[h].to_last), h);
+        }
+
+        std::vector<bool> dropped(hunks.size());
+        for (auto &deletion : hunks) {
+            if (deletion.kind != hunk::deleted)
+                continue;
+            auto matches = insertions.equal_range(run_key(a_keys.data(), deletion.first, deletion.last));
+            for (auto match = matches.first; match != matches.second; ++match) {
+                const auto &insertion = hunks[match->second];
+                if (insertion.to_last - insertion.to_first == deletion.last - deletion.first &&
+                    std::equal(a_keys.begin() + deletion.first, a_keys.begin() + deletion.last, b_keys.begin() + insertion.to_first)) {
+                    deletion.kind = hunk::moved;
+                    deletion.to_first = insertion.to_first;
+                    deletion.to_last = insertion.to_last;
+                    dropped[match->second] = true;
+                    insertions.erase(match);
+                    break;
+                }
+            }
+        }
+
+        size_t kept = 0;
+        for (size_t h = 0; h < hunks.size(); h++)
+            if (!dropped[h])
+                hunks[kept++] = hunks[h];
+        hunks.resize(kept);
+    }
+};
+
+// Prints one line per hunk: "-" deleted, "+" inserted, ">" moved, then the
+// line:column of its first token and its tokens separated by spaces.
+void print_diff(std::ostream &str, const std::vector<diff_token> &a, const std::vector<diff_token> &b, const token_diff &diff) {
+    auto print_tokens = [&](const std::vector<diff_token> &tokens, size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+            str << ' ' << tokens[i].spelling;
+        str << '\n';
+    };
+    for (const auto &hunk : diff.hunks) {
+        switch (hunk.kind) {
+            case token_diff::hunk::deleted:
+                str << "- " << a[hunk.first].line << ':' << a[hunk.first].column;
+                print_tokens(a, hunk.first, hunk.last);
+                break;
+            case token_diff::hunk::inserted:
+                str << "+ " << b[hunk.to_first].line << ':' << b[hunk.to_first].column;
+                print_tokens(b, hunk.to_first, hunk.to_last);
+                break;
+            case token_diff::hunk::moved:
+                str << "> " << a[hunk.first].line << ':' << a[hunk.first].column
+                    << " -> " << b[hunk.to_first].line << ':' << b[hunk.to_first].column;
+                print_tokens(a, hunk.first, hunk.last);
+                break;
+        }
+    }
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <vector>
+
+#include "tokenizer.hpp"
+
+// Index based expression tree. Nodes refer to their operands by index into
+// the arena that owns them, so a whole tree is one contiguous allocation.
+struct expression_node {
+    static constexpr uint32_t no_node = UINT32_MAX;
+
+    enum kind_type : uint8_t {
+        number_node,
+        symbol_node,
+        negate_node,
+        add_node,
+        subtract_node,
+        multiply_node,
+        divide_node,
+        assign_node
+    } kind = number_node;
+
+    uint32_t lhs = no_node; // Operand of negate_node
+    uint32_t rhs = no_node;
+
+    // Spelling of numbers and symbols, or the operator character.
+    const char* position = nullptr;
+    uint32_t length = 0;
+    uint32_t column = 0;
+
+    std::string_view string_view() const {
+        return std::string_view(position, length);
+    }
+};
+
+struct expression_arena {
+    std::vector<expression_node> nodes;
+
+    uint32_t push(const expression_node &node) {
+        nodes.push_back(node);
+        return uint32_t(nodes.size() - 1);
+    }
+
+    const expression_node &operator [] (uint32_t index) const {
+        assert(index < nodes.size());
+        return nodes[index];
+    }
+
+    void clear() {
+        nodes.clear();
+    }
+};
+
+// Pratt parser for the calculator language, reading tokens straight from the
+// scanner as it builds the tree. Precedence, lowest first:
+//   a = b      (right associative, a must be a symbol)
+//   a + b, a - b
+//   a * b, a / b
+//   -a
+struct expression_parser {
+    static constexpr size_t max_depth = 256;
+
+    tokenizer scanner;
+    expression_arena &arena;
+    token current = {};
+    size_t depth = 0;
+
+    const char* error = nullptr;
+    token error_token = {};
+
+    expression_parser(const tokenizer &scanner, expression_arena &arena)
+        : scanner(scanner), arena(arena) {}
+
+    // Parses the whole buffer as one expression. Returns the root node index,
+    // or no_node with `error` and `error_token` set.
+    uint32_t parse() {
+        // A tree never has more nodes than the buffer has bytes, so reserving
+        // up front turns every push into a bump of the end index.
+        arena.nodes.reserve(arena.nodes.size() + (scanner.end - scanner.position) + 1);
+
+        advance();
+        uint32_t root = parse_expression(0);
+        if (root != expression_node::no_node && current.kind != token::eol_kind)
+            return fail("unexpected token after expression");
+        return root;
+    }
+
+    void advance() {
+        current = scanner.next_token();
+    }
+
+    uint32_t fail(const char* message) {
+        return fail(message, current);
+    }
+
+    uint32_t fail(const char* message, const token &at) {
+        if (error == nullptr) {
+            error = message;
+            error_token = at;
+        }
+        return expression_node::no_node;
+    }
+
+    static int binding_power(const token &tkn) {
+        if (tkn.kind != token::punctuation_kind)
+            return 0;
+        switch (tkn.position[0]) {
+            case '=': return 1;
+            case '+':
+            case '-': return 2;
+            case '*':
+            case '/': return 3;
+        }
+        return 0;
+    }
+
+    uint32_t push_operator(expression_node::kind_type kind, const token &op, uint32_t lhs, uint32_t rhs) {
+        return arena.push({kind, lhs, rhs, op.position, uint32_t(op.length), uint32_t(op.column)});
+    }
+
+    uint32_t parse_expression(int min_power) {
+        if (depth == max_depth)
+            return fail("expression nested too deeply");
+        depth++;
+
+        uint32_t lhs = parse_prefix();
+
+        while (lhs != expression_node::no_node) {
+            int power = binding_power(current);
+            if (power <= min_power)
+                break;
+
+            token op = current;
+            advance();
+
+            if (op.position[0] == '=') {
+                if (arena[lhs].kind != expression_node::symbol_node) {
+                    lhs = fail("left side of assignment must be a symbol", op);
+                    break;
+                }
+                // Right associative: a = b = c is a = (b = c)
+                uint32_t rhs = parse_expression(power - 1);
+                if (rhs == expression_node::no_node)
+                    lhs = rhs;
+                else
+                    lhs = push_operator(expression_node::assign_node, op, lhs, rhs);
+                continue;
+            }
+
+            uint32_t rhs = parse_expression(power);
+            if (rhs == expression_node::no_node) {
+                lhs = rhs;
+                break;
+            }
+
+            expression_node::kind_type kind = expression_node::add_node;
+            switch (op.position[0]) {
+                case '+': kind = expression_node::add_node; break;
+                case '-': kind = expression_node::subtract_node; break;
+                case '*': kind = expression_node::multiply_node; break;
+                case '/': kind = expression_node::divide_node; break;
+            }
+            lhs = push_operator(kind, op, lhs, rhs);
+        }
+
+        depth--;
+        return lhs;
+    }
+
+    uint32_t parse_prefix() {
+        token tkn = current;
+        switch (tkn.kind) {
+            case token::number_kind:
+                advance();
+                return arena.push({
+                    expression_node::number_node,
+                    expression_node::no_node, expression_node::no_node,
+                    tkn.position, uint32_t(tkn.length), uint32_t(tkn.column)
+                });
+            case token::symbol_kind:
+                advance();
+                return arena.push({
+                    expression_node::symbol_node,
+                    expression_node::no_node, expression_node::no_node,
+                    tkn.position, uint32_t(tkn.length), uint32_t(tkn.column)
+                });
+            case token::punctuation_kind:
+                if (tkn.position[0] == '(') {
+                    advance();
+                    uint32_t inner = parse_expression(0);
+                    if (inner == expression_node::no_node)
+                        return inner;
+                    if (current.kind != token::punctuation_kind || current.position[0] != ')')
+                        return fail("expected ')'");
+                    advance();
+                    return inner;
+                }
+                if (tkn.position[0] == '-') {
+                    advance();
+                    // Binds tighter than any binary operator
+                    uint32_t operand = parse_expression(3);
+                    if (operand == expression_node::no_node)
+                        return operand;
+                    return push_operator(expression_node::negate_node, tkn, operand, expression_node::no_node);
+                }
+                return fail("expected an operand");
+            case token::eol_kind:
+                return fail("unexpected end of line");
+            case token::bad_char_kind:
+                return fail("bad character");
+        }
+        return fail("expected an operand");
+    }
+};
+
+// Writes the tree as an s-expression, e.g. (= x (* a (+ b 1.5))).
+void print_expression(std::ostream &str, const expression_arena &arena, uint32_t index) {
+    const auto &node = arena[index];
+    switch (node.kind) {
+        case expression_node::number_node:
+        case expression_node::symbol_node:
+            str << node.string_view();
+            return;
+        case expression_node::negate_node:
+            str << "(- ";
+            print_expression(str, arena, node.lhs);
+            str << ")";
+            return;
+        default:
+            str << "(" << node.string_view() << " ";
+            print_expression(str, arena, node.lhs);
+            str << " ";
+            print_expression(str, arena, node.rhs);
+            str << ")";
+            return;
+    }
+}
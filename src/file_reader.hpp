@@ -0,0 +1,411 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define TOKENIZER_HAS_IO_URING 1
+#endif
+#endif
+
+// Reads many (small) files and hands each one to a callback as soon as it
+// has been read:
+//
+//   callback(file index, contents, error)
+//
+// `error` is an errno value, with empty contents, when the file could not be
+// read. Non-empty contents always end with a '\n' (one is added if the file
+// lacks it), so every line can be scanned in place with
+// tokenizer::from_line. The callback always runs on the calling thread.
+//
+// Opening, reading and closing go through io_uring in batches, with a fixed
+// pool of read buffers. Where io_uring is not available (old kernels,
+// seccomp, or TOKENIZER_NO_IO_URING set in the environment) a small pool of
+// threads does blocking open/pread/close instead.
+struct file_reader {
+    enum backend_type {
+        automatic_backend,
+        io_uring_backend,
+        thread_pool_backend
+    };
+
+    static const size_t buffer_count = 32;
+    static const size_t buffer_size = 1 << 16;
+
+    backend_type backend = automatic_backend;
+
+    // Reads the rest of a file from the fd's current position. Plain reads,
+    // not pread, so pipes and FIFOs work too.
+    static int read_rest(int fd, std::string &contents) {
+        char chunk[buffer_size];
+        while (true) {
+            ssize_t count = ::read(fd, chunk, sizeof(chunk));
+            if (count < 0) {
+                if (errno == EINTR)
+                    continue;
+                return errno;
+            }
+            if (count == 0)
+                return 0;
+            contents.append(chunk, count);
+        }
+    }
+
+    static int read_file(const char* path, std::string &contents) {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return errno;
+        contents.clear();
+        int error = read_rest(fd, contents);
+        close(fd);
+        return error;
+    }
+
+    static std::string_view terminate_lines(std::string &contents) {
+        if (!contents.empty() && contents.back() != '\n')
+            contents += '\n';
+        return contents;
+    }
+
+    template <typename Callback>
+    void read_with_thread_pool(const std::vector<std::string> &paths, Callback &callback) {
+        struct result {
+            size_t index;
+            std::string contents;
+            int error;
+        };
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<result> done;
+        std::atomic<size_t> next_index = {0};
+        size_t delivered = 0;
+
+        size_t thread_count = std::min<size_t>(8, paths.size());
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < thread_count; t++) {
+            threads.emplace_back([&]() {
+                while (true) {
+                    size_t index = next_index++;
+                    if (index >= paths.size())
+                        return;
+                    result next = {index, {}, 0};
+                    next.error = read_file(paths[index].c_str(), next.contents);
+
+                    // Bounded like the io_uring buffer pool
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return done.size() < buffer_count; });
+                    done.push_back(std::move(next));
+                    changed.notify_all();
+                }
+            });
+        }
+
+        while (delivered < paths.size()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&]() { return !done.empty(); });
+            result next = std::move(done.front());
+            done.pop_front();
+            changed.notify_all();
+            lock.unlock();
+
+            if (next.error != 0)
+                callback(next.index, std::string_view(), next.error);
+            else
+                callback(next.index, terminate_lines(next.contents), 0);
+            delivered++;
+        }
+
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+#ifdef TOKENIZER_HAS_IO_URING
+    // Minimal io_uring wrapper over the raw system calls.
+    struct io_uring_queue {
+        int ring_fd = -1;
+        unsigned entries = 0;
+
+        void* sq_ring = MAP_FAILED;
+        void* cq_ring = MAP_FAILED;
+        size_t sq_ring_size = 0;
+        size_t cq_ring_size = 0;
+        io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        size_t sqes_size = 0;
+
+        unsigned* sq_head = nullptr;
+        unsigned* sq_tail = nullptr;
+        unsigned* sq_mask = nullptr;
+        unsigned* sq_array = nullptr;
+        unsigned* cq_head = nullptr;
+        unsigned* cq_tail = nullptr;
+        unsigned* cq_mask = nullptr;
+        io_uring_cqe* cqes = nullptr;
+
+        unsigned local_tail = 0;
+        unsigned to_submit = 0;
+
+        bool init(unsigned requested_entries) {
+            io_uring_params params = {};
+            ring_fd = int(syscall(__NR_io_uring_setup, requested_entries, &params));
+            if (ring_fd < 0)
+                return false;
+            entries = params.sq_entries;
+
+            sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (single_mmap)
+                sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+
+            sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+            if (sq_ring == MAP_FAILED)
+                return false;
+            cq_ring = single_mmap ? sq_ring : mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+            if (cq_ring == MAP_FAILED)
+                return false;
+            sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+            sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+            if (sqes == MAP_FAILED)
+                return false;
+
+            auto sq = static_cast<char*>(sq_ring);
+            sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+            sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            auto cq = static_cast<char*>(cq_ring);
+            cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            local_tail = *sq_tail;
+
+            // Reads use offset -1, the file position, so pipes read the same
+            // way as regular files.
+            if (!(params.features & IORING_FEAT_RW_CUR_POS))
+                return false;
+            return supports({IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_CLOSE});
+        }
+
+        bool supports(std::initializer_list<int> ops) {
+            const size_t op_count = 256;
+            std::vector<char> storage(sizeof(io_uring_probe) + op_count * sizeof(io_uring_probe_op));
+            auto probe = reinterpret_cast<io_uring_probe*>(storage.data());
+            if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, op_count) < 0)
+                return false;
+            for (int op : ops)
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                    return false;
+            return true;
+        }
+
+        ~io_uring_queue() {
+            if (sqes != MAP_FAILED)
+                munmap(sqes, sqes_size);
+            if (cq_ring != MAP_FAILED && cq_ring != sq_ring)
+                munmap(cq_ring, cq_ring_size);
+            if (sq_ring != MAP_FAILED)
+                munmap(sq_ring, sq_ring_size);
+            if (ring_fd >= 0)
+                close(ring_fd);
+        }
+
+        io_uring_sqe* next_sqe(uint64_t user_data) {
+            unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+            assert(local_tail - head < entries);
+            unsigned index = local_tail & *sq_mask;
+            io_uring_sqe* sqe = &sqes[index];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->user_data = user_data;
+            sq_array[index] = index;
+            local_tail++;
+            to_submit++;
+            return sqe;
+        }
+
+        // Submits the prepared entries and waits for at least one completion.
+        bool submit_and_wait() {
+            __atomic_store_n(sq_tail, local_tail, __ATOMIC_RELEASE);
+            while (true) {
+                long result = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+                if (result >= 0) {
+                    to_submit -= unsigned(result);
+                    return true;
+                }
+                if (errno != EINTR)
+                    return false;
+            }
+        }
+
+        template <typename Handler>
+        void for_each_completion(Handler &&handler) {
+            unsigned head = *cq_head;
+            unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+            for (; head != tail; head++) {
+                const io_uring_cqe &cqe = cqes[head & *cq_mask];
+                handler(cqe.user_data, cqe.res);
+            }
+            __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+        }
+    };
+
+    // Returns false, before calling the callback, when io_uring is unusable.
+    template <typename Callback>
+    bool read_with_io_uring(const std::vector<std::string> &paths, Callback &callback) {
+        enum step_type : uint64_t { open_step, read_step, close_step };
+
+        struct slot {
+            size_t index = 0;
+            int fd = -1;
+            size_t length = 0; // Bytes read into the buffer so far
+            bool busy = false;
+            bool delivered = false;
+        };
+
+        io_uring_queue queue;
+        if (!queue.init(2 * buffer_count))
+            return false;
+
+        // One extra byte per buffer for the '\n' added to unterminated files
+        std::vector<char> buffers(buffer_count * (buffer_size + 1));
+        slot slots[buffer_count];
+        size_t next_index = 0;
+        size_t busy = 0;
+        std::string large;
+
+        auto user_data = [](step_type step, size_t slot_index) {
+            return (uint64_t(step) << 32) | slot_index;
+        };
+        // Fills the rest of the slot's buffer from the file position
+        auto submit_read = [&](size_t s) {
+            auto sqe = queue.next_sqe(user_data(read_step, s));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = slots[s].fd;
+            sqe->addr = reinterpret_cast<uint64_t>(buffers.data() + s * (buffer_size + 1) + slots[s].length);
+            sqe->len = unsigned(buffer_size - slots[s].length);
+            sqe->off = uint64_t(-1);
+        };
+        auto submit_close = [&](size_t s) {
+            auto sqe = queue.next_sqe(user_data(close_step, s));
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->fd = slots[s].fd;
+        };
+
+        while (next_index < paths.size() || busy != 0) {
+            for (size_t s = 0; s < buffer_count && next_index < paths.size(); s++) {
+                if (slots[s].busy)
+                    continue;
+                slots[s] = {next_index++, -1, 0, true, false};
+                busy++;
+                auto sqe = queue.next_sqe(user_data(open_step, s));
+                sqe->opcode = IORING_OP_OPENAT;
+                sqe->fd = AT_FDCWD;
+                sqe->addr = reinterpret_cast<uint64_t>(paths[slots[s].index].c_str());
+                sqe->open_flags = O_RDONLY | O_CLOEXEC;
+            }
+
+            if (!queue.submit_and_wait()) {
+                // The ring broke down: finish every file not yet delivered
+                // without it
+                for (auto &current : slots)
+                    if (current.busy && current.fd >= 0)
+                        close(current.fd);
+                std::string contents;
+                for (auto &current : slots) {
+                    if (!current.busy || current.delivered)
+                        continue;
+                    int error = read_file(paths[current.index].c_str(), contents);
+                    callback(current.index, error ? std::string_view() : terminate_lines(contents), error);
+                }
+                for (; next_index < paths.size(); next_index++) {
+                    int error = read_file(paths[next_index].c_str(), contents);
+                    callback(next_index, error ? std::string_view() : terminate_lines(contents), error);
+                }
+                return true;
+            }
+
+            queue.for_each_completion([&](uint64_t data, int32_t result) {
+                size_t s = size_t(data & 0xffffffff);
+                auto &current = slots[s];
+                char* buffer = buffers.data() + s * (buffer_size + 1);
+
+                switch (step_type(data >> 32)) {
+                    case open_step:
+                        if (result < 0) {
+                            callback(current.index, std::string_view(), -result);
+                            current.busy = false;
+                            busy--;
+                            return;
+                        }
+                        current.fd = result;
+                        submit_read(s);
+                        return;
+                    case read_step:
+                        // Short reads (pipes, slow files) are not the end:
+                        // only a read of 0 bytes is.
+                        if (result > 0) {
+                            current.length += size_t(result);
+                            if (current.length < buffer_size) {
+                                submit_read(s);
+                                return;
+                            }
+                        }
+                        current.delivered = true;
+                        if (result < 0) {
+                            callback(current.index, std::string_view(), -result);
+                        }
+                        else if (current.length == buffer_size) {
+                            // Larger than a buffer: finish it with plain reads
+                            large.assign(buffer, buffer_size);
+                            int error = read_rest(current.fd, large);
+                            callback(current.index, error ? std::string_view() : terminate_lines(large), error);
+                        }
+                        else {
+                            size_t length = current.length;
+                            if (length != 0 && buffer[length - 1] != '\n')
+                                buffer[length++] = '\n';
+                            callback(current.index, std::string_view(buffer, length), 0);
+                        }
+                        submit_close(s);
+                        return;
+                    case close_step:
+                        current.busy = false;
+                        busy--;
+                        return;
+                }
+            });
+        }
+        return true;
+    }
+#endif
+
+    template <typename Callback>
+    void read(const std::vector<std::string> &paths, Callback &&callback) {
+#ifdef TOKENIZER_HAS_IO_URING
+        bool use_io_uring =
+            backend == io_uring_backend ||
+            (backend == automatic_backend && std::getenv("TOKENIZER_NO_IO_URING") == nullptr);
+        if (use_io_uring && read_with_io_uring(paths, callback))
+            return;
+#endif
+        read_with_thread_pool(paths, callback);
+    }
+};
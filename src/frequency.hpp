@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "hash.hpp"
+#include "tokenizer.hpp"
+
+// Count-Min sketch: `depth` rows of `width` counters. An estimate never
+// undercounts, and overcounts by more than e / width of the total with
+// probability at most exp(-depth).
+struct count_min_sketch {
+    size_t width;
+    size_t depth;
+    unsigned shift; // 64 - log2(width)
+    std::vector<uint64_t> counters;
+    uint64_t total = 0;
+
+    count_min_sketch(size_t width, size_t depth) : width(width), depth(depth), counters(width * depth) {
+        assert(width >= 2 && (width & (width - 1)) == 0);
+        shift = 64 - __builtin_ctzll(width);
+    }
+
+    // Row i uses h1 + i * h2, derived from one hash (Kirsch-Mitzenmacher).
+    size_t column_of(uint64_t hash, size_t row) const {
+        uint64_t h2 = (hash >> 32 | hash << 32) | 1;
+        return ((hash + row * h2) * 0x9e3779b97f4a7c15) >> shift;
+    }
+
+    void add(uint64_t hash, uint64_t count = 1) {
+        for (size_t row = 0; row < depth; row++)
+            counters[row * width + column_of(hash, row)] += count;
+        total += count;
+    }
+
+    uint64_t estimate(uint64_t hash) const {
+        uint64_t result = UINT64_MAX;
+        for (size_t row = 0; row < depth; row++)
+            result = std::min(result, counters[row * width + column_of(hash, row)]);
+        return result;
+    }
+
+    uint64_t error_bound() const {
+        return uint64_t(std::ceil(std::exp(1.0) / double(width) * double(total)));
+    }
+
+    void merge(const count_min_sketch &other) {
+        assert(width == other.width && depth == other.depth);
+        for (size_t i = 0; i < counters.size(); i++)
+            counters[i] += other.counters[i];
+        total += other.total;
+    }
+};
+
+// Space-Saving: the `capacity` most frequent keys, with a count that may
+// overcount by at most `error`. Every key more frequent than total / capacity
+// is kept. Entries form a min-heap on count, so the entry to replace is
+// always on top.
+struct space_saving {
+    struct entry {
+        std::string key;
+        uint64_t hash;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    size_t capacity;
+    std::vector<entry> entries;
+    std::vector<uint32_t> heap;          // Entry indices, least count first
+    std::vector<uint32_t> heap_position; // Per entry
+    std::unordered_map<uint64_t, uint32_t> index; // Hash -> entry
+
+    explicit space_saving(size_t capacity) : capacity(capacity) {
+        assert(capacity > 0);
+        entries.reserve(capacity);
+        heap.reserve(capacity);
+        heap_position.reserve(capacity);
+        index.reserve(capacity);
+    }
+
+    bool full() const {
+        return entries.size() == capacity;
+    }
+
+    // Least count a key can have and still be missing: the smallest count
+    // kept, or 0 while there is room.
+    uint64_t missing_count() const {
+        return full() ? entries[heap[0]].count : 0;
+    }
+
+    void add(uint64_t hash, std::string_view key, uint64_t count = 1) {
+        auto found = index.find(hash);
+        if (found != index.end()) {
+            entries[found->second].count += count;
+            sift_down(heap_position[found->second]);
+            return;
+        }
+        if (!full()) {
+            uint32_t added = uint32_t(entries.size());
+            entries.push_back({std::string(key), hash, count, 0});
+            heap.push_back(added);
+            heap_position.push_back(added);
+            index.emplace(hash, added);
+            sift_up(added);
+            return;
+        }
+        uint32_t least = heap[0];
+        auto &replaced = entries[least];
+        index.erase(replaced.hash);
+        replaced.key.assign(key);
+        replaced.hash = hash;
+        replaced.error = replaced.count;
+        replaced.count += count;
+        index.emplace(hash, least);
+        sift_down(0);
+    }
+
+    // Mergeable summaries (Agarwal et al.): a key missing from one side may
+    // have had up to that side's missing_count there.
+    void merge(const space_saving &other) {
+        uint64_t missing_here = missing_count();
+        uint64_t missing_there = other.missing_count();
+        std::vector<entry> combined = entries;
+        for (auto &kept : combined) {
+            auto found = other.index.find(kept.hash);
+            if (found != other.index.end()) {
+                kept.count += other.entries[found->second].count;
+                kept.error += other.entries[found->second].error;
+            }
+            else {
+                kept.count += missing_there;
+                kept.error += missing_there;
+            }
+        }
+        for (const auto &theirs : other.entries) {
+            if (index.count(theirs.hash) == 0)
+                combined.push_back({theirs.key, theirs.hash, theirs.count + missing_here, theirs.error + missing_here});
+        }
+
+        if (combined.size() > capacity) {
+            std::nth_element(combined.begin(), combined.begin() + capacity, combined.end(),
+                [](const entry &a, const entry &b) { return a.count > b.count; });
+            combined.resize(capacity);
+        }
+        entries.clear();
+        heap.clear();
+        heap_position.clear();
+        index.clear();
+        for (auto &kept : combined) {
+            uint32_t added = uint32_t(entries.size());
+            entries.push_back(std::move(kept));
+            heap.push_back(added);
+            heap_position.push_back(added);
+            index.emplace(entries.back().hash, added);
+            sift_up(added);
+        }
+    }
+
+    // Entries by decreasing count.
+    std::vector<entry> top() const {
+        std::vector<entry> result = entries;
+        std::sort(result.begin(), result.end(), [](const entry &a, const entry &b) {
+            return a.count > b.count || (a.count == b.count && a.key < b.key);
+        });
+        return result;
+    }
+
+    void swap_heap(size_t a, size_t b) {
+        std::swap(heap[a], heap[b]);
+        heap_position[heap[a]] = uint32_t(a);
+        heap_position[heap[b]] = uint32_t(b);
+    }
+
+    void sift_up(size_t position) {
+        while (position > 0) {
+            size_t parent = (position - 1) / 2;
+            if (entries[heap[parent]].count <= entries[heap[position]].count)
+                return;
+            swap_heap(parent, position);
+            position = parent;
+        }
+    }
+
+    void sift_down(size_t position) {
+        while (true) {
+            size_t least = position;
+            for (size_t child = 2 * position + 1; child <= 2 * position + 2 && child < heap.size(); child++)
+                if (entries[heap[child]].count < entries[heap[least]].count)
+                    least = child;
+            if (least == position)
+                return;
+            swap_heap(position, least);
+            position = least;
+        }
+    }
+};
+
+// Fixed-memory identifier frequencies: a Count-Min sketch answers "how often
+// did X occur" for any identifier, and Space-Saving keeps the top k. Each
+// thread fills its own, then they are merged.
+struct identifier_frequencies {
+    struct heavy_hitter {
+        std::string identifier;
+        uint64_t lower; // True count is in [lower, upper]
+        uint64_t upper;
+    };
+
+    count_min_sketch sketch;
+    space_saving top;
+
+    // Counters per row: 2^16 keeps the sketch error under 0.005% of the
+    // identifiers seen.
+    explicit identifier_frequencies(size_t k, size_t width = 1 << 16, size_t depth = 4)
+        : sketch(width, depth), top(k) {}
+
+    void add(std::string_view identifier) {
+        uint64_t hash = hash_bytes(identifier);
+        sketch.add(hash);
+        top.add(hash, identifier);
+    }
+
+    // Counts the identifiers of every line in `text`, which must end with '\n'.
+    void add_lines(std::string_view text) {
+        while (!text.empty()) {
+            size_t line_end = text.find('\n');
+            assert(line_end != std::string_view::npos);
+            auto tokenizer = tokenizer::from_line(text.substr(0, line_end));
+            tokenize<token::mask_of(token::symbol_kind)>(tokenizer, [&](const token &next_token) {
+                add(next_token.string_view());
+            });
+            text.remove_prefix(line_end + 1);
+        }
+    }
+
+    void merge(const identifier_frequencies &other) {
+        sketch.merge(other.sketch);
+        top.merge(other.top);
+    }
+
+    // The kept identifiers by decreasing count, each count bounded by both
+    // structures.
+    std::vector<heavy_hitter> report() const {
+        std::vector<heavy_hitter> result;
+        for (const auto &kept : top.top()) {
+            uint64_t upper = std::min(kept.count, sketch.estimate(kept.hash));
+            result.push_back({kept.key, kept.count - kept.error, upper});
+        }
+        return result;
+    }
+};
+
+std::ostream& operator << (std::ostream& str, const identifier_frequencies &frequencies) {
+    str << "identifiers " << frequencies.sketch.total
+        << ", top " << frequencies.top.capacity
+        << ", sketch overcount <= " << frequencies.sketch.error_bound()
+        << " with probability " << 1 - std::exp(-double(frequencies.sketch.depth)) << "\n";
+    for (const auto &hitter : frequencies.report()) {
+        str << "  " << hitter.identifier << ": ";
+        if (hitter.lower == hitter.upper)
+            str << hitter.lower << "\n";
+        else
+            str << hitter.lower << ".." << hitter.upper << "\n";
+    }
+    return str;
+}
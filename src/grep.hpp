@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "hash.hpp"
+#include "tokenizer.hpp"
+
+// A sequence of token predicates, matched with a bit-parallel Shift-And
+// automaton: bit i of the state is set when the last i + 1 tokens match the
+// first i + 1 predicates. Each token costs one shift, an or and an and with
+// the mask of predicates it satisfies.
+//
+// Pattern syntax, elements separated by whitespace:
+//   SYM NUM PCT BAD  any token of that kind
+//   ANY              any token
+//   'text'           a token spelled `text`
+//   anything else    the tokens it lexes to, by spelling: f( is 'f' '('
+struct token_pattern {
+    static const size_t max_length = 64;
+
+    struct literal {
+        std::string spelling;
+        uint64_t mask;
+    };
+
+    uint64_t kind_masks[token::bad_char_kind + 1] = {};
+    std::unordered_map<uint64_t, literal> literals; // By spelling hash
+    uint64_t literal_lengths = 0; // Bit n: a literal n bytes long, bit 63 for 63 and longer
+    size_t length = 0;
+    const char* error = nullptr;
+
+    static token_pattern compile(std::string_view pattern) {
+        token_pattern result;
+        while (result.error == nullptr) {
+            size_t start = pattern.find_first_not_of(" \t");
+            if (start == std::string_view::npos)
+                break;
+            pattern.remove_prefix(start);
+            std::string_view element = pattern.substr(0, pattern.find_first_of(" \t"));
+            pattern.remove_prefix(element.length());
+
+            if (element == "SYM")
+                result.add_kind(token::symbol_kind);
+            else if (element == "NUM")
+                result.add_kind(token::number_kind);
+            else if (element == "PCT")
+                result.add_kind(token::punctuation_kind);
+            else if (element == "BAD")
+                result.add_kind(token::bad_char_kind);
+            else if (element == "ANY")
+                result.add_any();
+            else if (element.front() == '\'') {
+                if (element.length() < 3 || element.back() != '\'')
+                    result.error = "bad quoted spelling";
+                else
+                    result.add_literal(element.substr(1, element.length() - 2));
+            }
+            else {
+                std::string text(element);
+                tokenize<token::all_kinds_mask & ~token::mask_of(token::eol_kind)>(text, [&](const token &next_token) {
+                    result.add_literal(next_token.string_view());
+                });
+            }
+        }
+        if (result.error == nullptr && result.length == 0)
+            result.error = "empty pattern";
+        return result;
+    }
+
+    // Claims the next predicate position, or sets `error`.
+    uint64_t next_bit() {
+        if (length == max_length) {
+            error = "pattern longer than 64 tokens";
+            return 0;
+        }
+        return uint64_t(1) << length++;
+    }
+
+    void add_kind(token::kind_type kind) {
+        kind_masks[kind] |= next_bit();
+    }
+
+    void add_any() {
+        uint64_t bit = next_bit();
+        for (auto &mask : kind_masks)
+            mask |= bit;
+    }
+
+    void add_literal(std::string_view spelling) {
+        uint64_t bit = next_bit();
+        auto &entry = literals[hash_bytes(spelling)];
+        entry.spelling = spelling;
+        entry.mask |= bit;
+        literal_lengths |= uint64_t(1) << std::min<size_t>(spelling.length(), 63);
+    }
+
+    // Predicates `tkn` satisfies, one bit per position.
+    uint64_t predicates_of(const token &tkn) const {
+        uint64_t mask = kind_masks[tkn.kind];
+        // Optimization(sorgre): Most tokens have a length no literal has, and
+        // skip hashing.
+        if (literal_lengths & (uint64_t(1) << std::min<size_t>(tkn.length, 63))) {
+            auto found = literals.find(hash_bytes(tkn.string_view()));
+            if (found != literals.end() && found->second.spelling == tkn.string_view())
+                mask |= found->second.mask;
+        }
+        return mask;
+    }
+
+    // Calls `on_match(position, column)` with the start of every match in
+    // the line `tokenizer` scans. Matches may overlap. Only the starts of the
+    // last 64 tokens are kept, in a ring; no token array is built.
+    template <typename Callback>
+    void match_line(tokenizer &tokenizer, Callback &&on_match) const {
+        const char* positions[max_length];
+        size_t columns[max_length];
+        uint64_t state = 0;
+        uint64_t accept = uint64_t(1) << (length - 1);
+        size_t count = 0;
+        tokenize<token::all_kinds_mask & ~token::mask_of(token::eol_kind)>(tokenizer, [&](const token &next_token) {
+            positions[count % max_length] = next_token.position;
+            columns[count % max_length] = next_token.column;
+            count++;
+            state = ((state << 1) | 1) & predicates_of(next_token);
+            if (state & accept) {
+                size_t first = (count - length) % max_length;
+                on_match(positions[first], columns[first]);
+            }
+        });
+    }
+};
+
+// Prints "line:column: text" for every match in `text`, whose lines must all
+// end with '\n'. Lines are numbered from `first_line`.
+void print_pattern_matches(std::ostream &str, const token_pattern &pattern, std::string_view text, size_t first_line) {
+    for (size_t line = first_line; !text.empty(); line++) {
+        size_t line_end = text.find('\n');
+        assert(line_end != std::string_view::npos);
+        auto line_text = text.substr(0, line_end);
+        auto tokenizer = tokenizer::from_line(line_text);
+        pattern.match_line(tokenizer, [&](const char*, size_t column) {
+            str << line << ':' << column << ": " << line_text << '\n';
+        });
+        text.remove_prefix(line_end + 1);
+    }
+}
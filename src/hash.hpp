@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+// Finalizer from splitmix64: every input bit affects every output bit.
+inline uint64_t hash_mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111eb;
+    x ^= x >> 31;
+    return x;
+}
+
+// 64-bit hash of a byte string, eight bytes per step. Not for adversarial
+// input.
+uint64_t hash_bytes(std::string_view bytes, uint64_t seed = 0) {
+    const char* p = bytes.data();
+    size_t n = bytes.size();
+    uint64_t h = hash_mix(seed ^ (n * 0x9e3779b97f4a7c15));
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        h = hash_mix(h ^ word);
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, p, n);
+    return hash_mix(h ^ tail);
+}
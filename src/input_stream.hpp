@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef TOKENIZER_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+// Reads a file as a byte stream, decompressing gzip input on the fly into the
+// caller's buffer, so neither an intermediate file nor a buffer for the whole
+// decompressed input is needed. The format is detected from the first bytes;
+// anything else is passed through unchanged.
+//
+// gzip support is built with -DTOKENIZER_WITH_ZLIB (link -lz). gzip input
+// without it, and zstd input, set `error`. Only the pipeline reads through
+// this; --files and --diff take their files as they are.
+struct input_stream {
+    enum format_type {
+        plain_format,
+        gzip_format,
+        zstd_format // Detected only, to reject it
+    };
+
+    static const size_t input_buffer_size = 1 << 17;
+
+    std::FILE* file;
+    format_type format = plain_format;
+    const char* error = nullptr;
+
+    std::vector<unsigned char> input;
+    size_t input_position = 0;
+    size_t input_length = 0;
+    bool input_done = false;
+    bool output_done = false;
+
+#ifdef TOKENIZER_WITH_ZLIB
+    z_stream zlib = {};
+    bool zlib_ready = false;
+#endif
+
+    explicit input_stream(std::FILE* file) : file(file), input(input_buffer_size) {
+        fill_input();
+        const unsigned char* magic = input.data();
+        if (input_length >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+            format = gzip_format;
+        else if (input_length >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd)
+            format = zstd_format;
+
+        switch (format) {
+            case plain_format:
+                break;
+            case gzip_format:
+#ifdef TOKENIZER_WITH_ZLIB
+                // 16 + MAX_WBITS: gzip header and trailer
+                if (inflateInit2(&zlib, 16 + MAX_WBITS) != Z_OK)
+                    error = "could not initialize zlib";
+                zlib_ready = error == nullptr;
+#else
+                error = "gzip input, but built without TOKENIZER_WITH_ZLIB";
+#endif
+                break;
+            case zstd_format:
+                error = "zstd input is not supported";
+                break;
+        }
+    }
+
+    ~input_stream() {
+#ifdef TOKENIZER_WITH_ZLIB
+        if (zlib_ready)
+            inflateEnd(&zlib);
+#endif
+    }
+
+    input_stream(const input_stream &) = delete;
+    input_stream& operator = (const input_stream &) = delete;
+
+    // Refills the input buffer once everything in it has been used.
+    void fill_input() {
+        if (input_position < input_length || input_done)
+            return;
+        input_position = 0;
+        input_length = std::fread(input.data(), 1, input.size(), file);
+        if (input_length == 0) {
+            input_done = true;
+            if (std::ferror(file))
+                error = "read error";
+        }
+    }
+
+    // Reads up to `size` (decompressed) bytes into `buffer`. Returns 0 at the
+    // end of the input or on error.
+    size_t read(char* buffer, size_t size) {
+        if (error != nullptr || output_done)
+            return 0;
+
+        switch (format) {
+            case plain_format: {
+                size_t count = 0;
+                while (count < size) {
+                    fill_input();
+                    if (input_position == input_length)
+                        break;
+                    size_t chunk = std::min(size - count, input_length - input_position);
+                    std::memcpy(buffer + count, input.data() + input_position, chunk);
+                    input_position += chunk;
+                    count += chunk;
+                }
+                return count;
+            }
+            case gzip_format:
+#ifdef TOKENIZER_WITH_ZLIB
+                return read_gzip(buffer, size);
+#else
+                return 0;
+#endif
+            case zstd_format:
+                return 0;
+        }
+        return 0;
+    }
+
+#ifdef TOKENIZER_WITH_ZLIB
+    size_t read_gzip(char* buffer, size_t size) {
+        zlib.next_out = reinterpret_cast<Bytef*>(buffer);
+        zlib.avail_out = uInt(size);
+        while (zlib.avail_out != 0) {
+            fill_input();
+            if (input_position == input_length) {
+                output_done = true;
+                if (zlib.total_in != 0)
+                    error = "truncated gzip input";
+                break;
+            }
+            zlib.next_in = input.data() + input_position;
+            zlib.avail_in = uInt(input_length - input_position);
+            int result = inflate(&zlib, Z_NO_FLUSH);
+            input_position = input_length - zlib.avail_in;
+            if (result == Z_STREAM_END) {
+                // Concatenated gzip members decode as one stream
+                inflateReset(&zlib);
+                fill_input();
+                if (input_position == input_length) {
+                    output_done = true;
+                    break;
+                }
+            }
+            else if (result != Z_OK && result != Z_BUF_ERROR) {
+                error = "corrupt gzip input";
+                break;
+            }
+        }
+        return size - zlib.avail_out;
+    }
+#endif
+};
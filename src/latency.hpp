@@ -0,0 +1,142 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Cheapest monotonic tick source available: the time stamp counter on x86,
+// otherwise steady_clock nanoseconds.
+struct latency_clock {
+#if defined(__x86_64__) || defined(__i386__)
+    static constexpr const char* unit = "cycles";
+
+    static uint64_t now() {
+        return __rdtsc();
+    }
+#else
+    static constexpr const char* unit = "ns";
+
+    static uint64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+#endif
+};
+
+// Log bucketed histogram in the style of HdrHistogram. Values below 32 get a
+// bucket each; above that, every power of two is split into 16 linear
+// sub-buckets, so a bucket is never wider than 1/16 of its values.
+struct latency_histogram {
+    static const int sub_bucket_bits = 4;
+    static const size_t sub_buckets = size_t(1) << sub_bucket_bits;
+    static const size_t bucket_count = (64 - sub_bucket_bits - 1) * sub_buckets + 2 * sub_buckets;
+
+    uint64_t counts[bucket_count] = {};
+    uint64_t total = 0;
+    uint64_t max = 0;
+
+    static size_t bucket_index(uint64_t value) {
+        if (value < 2 * sub_buckets)
+            return size_t(value);
+        int shift = (63 - __builtin_clzll(value)) - sub_bucket_bits;
+        return size_t(value >> shift) + size_t(shift) * sub_buckets;
+    }
+
+    // Smallest value that lands in bucket `index`.
+    static uint64_t bucket_value(size_t index) {
+        if (index < 2 * sub_buckets)
+            return index;
+        size_t shift = index / sub_buckets - 1;
+        return uint64_t(index - shift * sub_buckets) << shift;
+    }
+
+    void record(uint64_t value) {
+        counts[bucket_index(value)]++;
+        total++;
+        if (value > max)
+            max = value;
+    }
+
+    void merge(const latency_histogram &other) {
+        for (size_t i = 0; i < bucket_count; i++)
+            counts[i] += other.counts[i];
+        total += other.total;
+        if (other.max > max)
+            max = other.max;
+    }
+
+    // Upper end of the bucket holding the value at quantile `q` (0..1).
+    uint64_t percentile(double q) const {
+        if (total == 0)
+            return 0;
+        uint64_t rank = uint64_t(q * double(total) + 0.5);
+        if (rank == 0)
+            rank = 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                uint64_t upper = i + 1 < bucket_count ? bucket_value(i + 1) - 1 : max;
+                return upper < max ? upper : max;
+            }
+        }
+        return max;
+    }
+};
+
+std::ostream& operator << (std::ostream& str, const latency_histogram &histogram) {
+    str << "count " << histogram.total
+        << ", p50 " << histogram.percentile(0.5)
+        << ", p99 " << histogram.percentile(0.99)
+        << ", p999 " << histogram.percentile(0.999)
+        << ", max " << histogram.max
+        << " (" << latency_clock::unit << ")";
+    return str;
+}
+
+// The N slowest inputs seen, with a copy of each input.
+template <size_t N = 5>
+struct slowest_inputs {
+    struct entry {
+        uint64_t latency = 0;
+        std::string input;
+    };
+
+    entry entries[N];
+
+    void record(uint64_t latency, std::string_view input) {
+        size_t fastest = 0;
+        for (size_t i = 1; i < N; i++)
+            if (entries[i].latency < entries[fastest].latency)
+                fastest = i;
+        if (latency <= entries[fastest].latency)
+            return;
+        entries[fastest].latency = latency;
+        entries[fastest].input = input;
+    }
+};
+
+template <size_t N>
+std::ostream& operator << (std::ostream& str, const slowest_inputs<N> &slowest) {
+    bool printed[N] = {};
+    for (size_t rank = 0; rank < N; rank++) {
+        size_t slowest_index = N;
+        for (size_t i = 0; i < N; i++)
+            if (!printed[i] && slowest.entries[i].latency != 0 &&
+                (slowest_index == N || slowest.entries[i].latency > slowest.entries[slowest_index].latency))
+                slowest_index = i;
+        if (slowest_index == N)
+            break;
+        printed[slowest_index] = true;
+        const auto &entry = slowest.entries[slowest_index];
+        str << "  " << entry.latency << " " << latency_clock::unit << ": '" << entry.input << "'\n";
+    }
+    return str;
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "input_stream.hpp"
+#include "tokenizer.hpp"
+
+// Bounded lock-free ring buffer for exactly one producer thread and one
+// consumer thread. push() waits while the ring is full, which is what gives
+// the pipeline its backpressure.
+template <typename T, size_t N>
+struct spsc_ring {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+    // Optimization(sorgre): Each side keeps a cached copy of the other side's
+    // index and only reloads it when the ring looks full or empty, so the
+    // shared cache lines are touched once per batch instead of once per item.
+    alignas(64) std::atomic<size_t> head = {0}; // Next slot to pop, written by the consumer
+    size_t cached_tail = 0;
+    alignas(64) std::atomic<size_t> tail = {0}; // Next slot to push, written by the producer
+    size_t cached_head = 0;
+    alignas(64) T slots[N];
+
+    bool try_push(T &value) {
+        size_t index = tail.load(std::memory_order_relaxed);
+        if (index - cached_head == N) {
+            cached_head = head.load(std::memory_order_acquire);
+            if (index - cached_head == N)
+                return false;
+        }
+        slots[index % N] = std::move(value);
+        tail.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T &value) {
+        size_t index = head.load(std::memory_order_relaxed);
+        if (index == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (index == cached_tail)
+                return false;
+        }
+        value = std::move(slots[index % N]);
+        head.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    void push(T &value) {
+        while (!try_push(value))
+            std::this_thread::yield();
+    }
+
+    void pop(T &value) {
+        while (!try_pop(value))
+            std::this_thread::yield();
+    }
+};
+
+// Writes the tokens of every line in `text` like the REPL prints them.
+// Every line in `text` must end with '\n'.
+void print_line_tokens(std::ostream &str, std::string_view text) {
+    while (!text.empty()) {
+        size_t line_end = text.find('\n');
+        assert(line_end != std::string_view::npos);
+        auto tokenizer = tokenizer::from_line(text.substr(0, line_end));
+        tokenize(tokenizer, [&](const token &next_token) {
+            str << next_token << '\n';
+        });
+        text.remove_prefix(line_end + 1);
+    }
+}
+
+// Reader -> tokenizer workers -> writer pipeline over whole lines.
+//
+// The reader also decompresses gzip input (see input_stream), so
+// decompression runs on its own thread, overlapped with tokenizing.
+//
+// The reader cuts the input into blocks of whole lines and hands them to the
+// workers round robin; the writer collects the printed blocks from the
+// workers in the same order, so the output is in input order. Every hand-off
+// is a spsc_ring, so no locks are taken.
+//
+// With `analyze` set, workers hand each block to it instead of printing, and
+// nothing is written. With `print` set, workers print blocks with it instead
+// of printing every token.
+struct pipeline {
+    static const size_t ring_size = 8;
+
+    struct block {
+        std::string text;
+        size_t first_line = 1; // Number of the first line in `text`
+        bool last = false;
+    };
+
+    struct worker {
+        size_t index;
+        spsc_ring<block, ring_size> input;
+        spsc_ring<block, ring_size> output;
+        std::thread thread;
+    };
+
+    std::FILE* input_file;
+    std::FILE* output_file;
+    size_t block_size = 1 << 16;
+    const char* error = nullptr; // Input error, set when run() returns
+    // Called on worker `index`'s thread with blocks of whole lines
+    std::function<void(size_t index, std::string_view text)> analyze = nullptr;
+    // Called on a worker thread with blocks of whole lines, writing to `str`
+    std::function<void(std::ostream &str, std::string_view text, size_t first_line)> print = nullptr;
+
+    void read_blocks(std::vector<std::unique_ptr<worker>> &workers) {
+        input_stream input(input_file);
+        std::string carry;
+        std::vector<char> buffer(block_size);
+        size_t next_worker = 0;
+        size_t next_line = 1;
+
+        while (true) {
+            size_t count = input.read(buffer.data(), buffer.size());
+            if (count == 0)
+                error = input.error;
+            block next_block;
+            next_block.text = std::move(carry);
+            carry.clear();
+            next_block.text.append(buffer.data(), count);
+
+            if (count == 0) {
+                if (!next_block.text.empty() && next_block.text.back() != '\n')
+                    next_block.text += '\n';
+                next_block.last = true;
+            }
+            else {
+                // Only whole lines go out, the rest waits for the next read
+                size_t last_line_end = next_block.text.rfind('\n');
+                if (last_line_end == std::string::npos) {
+                    carry = std::move(next_block.text);
+                    continue;
+                }
+                carry.assign(next_block.text, last_line_end + 1, std::string::npos);
+                next_block.text.resize(last_line_end + 1);
+            }
+            next_block.first_line = next_line;
+            if (print)
+                next_line += std::count(next_block.text.begin(), next_block.text.end(), '\n');
+
+            if (next_block.last) {
+                // Every worker gets a last block, so they all stop
+                for (size_t i = 0; i < workers.size(); i++) {
+                    block last_block;
+                    last_block.last = true;
+                    if (i == 0) {
+                        last_block.text = std::move(next_block.text);
+                        last_block.first_line = next_block.first_line;
+                    }
+                    workers[(next_worker + i) % workers.size()]->input.push(last_block);
+                }
+                return;
+            }
+
+            workers[next_worker]->input.push(next_block);
+            next_worker = (next_worker + 1) % workers.size();
+        }
+    }
+
+    void tokenize_blocks(worker &self) {
+        std::ostringstream str;
+        block next_block;
+        do {
+            self.input.pop(next_block);
+            if (analyze) {
+                analyze(self.index, next_block.text);
+                next_block.text.clear();
+            }
+            else {
+                str.str("");
+                if (print)
+                    print(str, next_block.text, next_block.first_line);
+                else
+                    print_line_tokens(str, next_block.text);
+                next_block.text = str.str();
+            }
+            bool last = next_block.last;
+            self.output.push(next_block);
+            if (last)
+                break;
+        } while (true);
+    }
+
+    void write_blocks(std::vector<std::unique_ptr<worker>> &workers) {
+        size_t remaining = workers.size();
+        block next_block;
+        for (size_t next_worker = 0; remaining != 0; next_worker = (next_worker + 1) % workers.size()) {
+            auto &current = *workers[next_worker];
+            if (!current.thread.joinable())
+                continue;
+            current.output.pop(next_block);
+            if (!next_block.text.empty())
+                std::fwrite(next_block.text.data(), 1, next_block.text.size(), output_file);
+            if (next_block.last) {
+                current.thread.join();
+                remaining--;
+            }
+        }
+        std::fflush(output_file);
+    }
+
+    void run(size_t worker_count) {
+        if (worker_count == 0)
+            worker_count = 1;
+
+        std::vector<std::unique_ptr<worker>> workers;
+        for (size_t i = 0; i < worker_count; i++) {
+            workers.push_back(std::make_unique<worker>());
+            auto &current = *workers.back();
+            current.index = i;
+            current.thread = std::thread(&pipeline::tokenize_blocks, this, std::ref(current));
+        }
+
+        std::thread reader(&pipeline::read_blocks, this, std::ref(workers));
+        write_blocks(workers);
+        reader.join();
+    }
+};
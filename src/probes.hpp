@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+#include "compile_time.hpp"
+
+// Static tracepoints (USDT, provider "tokenizer") for perf and bpftrace, e.g.
+//   bpftrace -e 'usdt:./tokenizer:tokenizer:bad_char { @[arg2] = count(); }'
+//
+// A probe site is a single nop plus an ELF note describing where its
+// arguments live, so tracing a running binary needs no rebuild and costs
+// nothing while no tracer is attached. <sys/sdt.h> is used when available;
+// otherwise x86-64 builds emit the same notes directly. Build with
+// -DTOKENIZER_NO_PROBES to leave them out.
+//
+// Probes:
+//   next_token_entry(position, remaining bytes)
+//   next_token_exit(kind, scan start, bytes scanned)
+//   utf8_slow_path(position, column)
+//   bad_char(position, length, error)
+//   buffer_done(end, column)
+
+#if !defined(TOKENIZER_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define TOKENIZER_PROBE2(name, a, b) \
+    do { if (!constant_evaluation()) DTRACE_PROBE2(tokenizer, name, a, b); } while (0)
+#define TOKENIZER_PROBE3(name, a, b, c) \
+    do { if (!constant_evaluation()) DTRACE_PROBE3(tokenizer, name, a, b, c); } while (0)
+#elif defined(__x86_64__) && defined(__GNUC__)
+// Same note layout as <sys/sdt.h> (version 3), with every argument passed as
+// an unsigned 64-bit value.
+#define TOKENIZER_SDT_NOTE(name, args)                                          \
+    "990: nop\n"                                                                \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"                               \
+    ".balign 4\n"                                                               \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                          \
+    "991: .asciz \"stapsdt\"\n"                                                 \
+    "992: .balign 4\n"                                                          \
+    "993: .8byte 990b\n"                                                        \
+    ".8byte _.stapsdt.base\n"                                                   \
+    ".8byte 0\n"                                                                \
+    ".asciz \"tokenizer\"\n"                                                    \
+    ".asciz \"" #name "\"\n"                                                    \
+    ".asciz \"" args "\"\n"                                                     \
+    "994: .balign 4\n"                                                          \
+    ".popsection\n"                                                             \
+    ".ifndef _.stapsdt.base\n"                                                  \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"     \
+    ".weak _.stapsdt.base\n"                                                    \
+    ".hidden _.stapsdt.base\n"                                                  \
+    "_.stapsdt.base: .space 1\n"                                                \
+    ".size _.stapsdt.base, 1\n"                                                 \
+    ".popsection\n"                                                             \
+    ".endif\n"
+#define TOKENIZER_PROBE2(name, a, b)                                            \
+    do { if (!constant_evaluation()) __asm__ __volatile__ (                     \
+        TOKENIZER_SDT_NOTE(name, "8@%0 8@%1")                                   \
+        :: "nor"(uint64_t(a)), "nor"(uint64_t(b))); } while (0)
+#define TOKENIZER_PROBE3(name, a, b, c)                                         \
+    do { if (!constant_evaluation()) __asm__ __volatile__ (                     \
+        TOKENIZER_SDT_NOTE(name, "8@%0 8@%1 8@%2")                              \
+        :: "nor"(uint64_t(a)), "nor"(uint64_t(b)), "nor"(uint64_t(c))); } while (0)
+#endif
+#endif
+
+#ifndef TOKENIZER_PROBE2
+#define TOKENIZER_PROBE2(name, a, b) ((void)sizeof((a), (b)))
+#define TOKENIZER_PROBE3(name, a, b, c) ((void)sizeof((a), (b), (c)))
+#endif
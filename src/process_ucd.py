@@ -50,23 +50,23 @@ destination += "// Ths is a generated file. DO NOT CHANGE!\n\n"
 destination += "#include <cstdint>\n\n"
 
 
-destination += "uint32_t id_start_table[][2] = {\n"
+destination += "constexpr uint32_t id_start_table[][2] = {\n"
 for (c1, c2) in id_start:
     destination += "    {}, {},  //".format(c1, c2)
     for i in range(c1, c2 + 1):
         destination += chr(i)
     destination += "\n"
 destination += "};\n"
-destination += "size_t id_start_table_len = sizeof(id_start_table) / sizeof(id_start_table[0]);\n\n"
+destination += "constexpr size_t id_start_table_len = sizeof(id_start_table) / sizeof(id_start_table[0]);\n\n"
 
-destination += "uint32_t id_continue_table[][2] = {\n"
+destination += "constexpr uint32_t id_continue_table[][2] = {\n"
 for (c1, c2) in  id_continue:
     destination += "    {}, {},  //".format(c1, c2)
     for i in range(c1, c2 + 1):
         destination += chr(i)
     destination += "\n"
 destination += "};\n"
-destination += "size_t id_continue_table_len = sizeof(id_continue_table) / sizeof(id_continue_table[0]);\n\n"
+destination += "constexpr size_t id_continue_table_len = sizeof(id_continue_table) / sizeof(id_continue_table[0]);\n\n"
 
 with open('unicode_tables.h', 'w') as file:
     file.write(destination)
@@ -0,0 +1,228 @@
+// Python extension: tokenizes a bytes-like object in one call and returns the
+// token kinds, offsets and lengths as buffer protocol arrays, so NumPy (or a
+// memoryview) reads them without any per-token Python object. The GIL is
+// released while lexing.
+//
+// Build:
+//   g++ -O2 -std=c++17 -march=native -shared -fPIC $(python3-config --includes) src/python_module.cpp -o tokenizer$(python3-config --extension-suffix)
+//
+// Use:
+//   kinds, offsets, lengths = tokenizer.tokenize(data)
+//   numpy.frombuffer(kinds, numpy.uint8)   # or numpy.asarray(kinds)
+//
+// Test against the tokenizer binary: see src/test_python_module.py.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <new>
+#include <vector>
+
+#include "tokenizer.hpp"
+
+// Tokens of a whole text, one column per field. Lines are split on '\n' and
+// each ends with an end of line token, the last one too.
+struct token_columns {
+    std::vector<uint8_t> kinds;
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> lengths;
+
+    void lex(std::string_view text, bool coalesce_bad_bytes) {
+        // About one token per 4 bytes in source code.
+        kinds.reserve(text.size() / 4);
+        offsets.reserve(text.size() / 4);
+        lengths.reserve(text.size() / 4);
+
+        std::string last_line; // The last line, if it has no '\n' to stop the scan
+        for (size_t line_start = 0; line_start < text.size();) {
+            size_t line_end = text.find('\n', line_start);
+            std::string_view line;
+            if (line_end == std::string_view::npos) {
+                last_line.assign(text.substr(line_start));
+                line = last_line;
+                line_end = text.size();
+            }
+            else {
+                line = text.substr(line_start, line_end - line_start);
+            }
+
+            auto scanner = tokenizer::from_line(line);
+            scanner.coalesce_bad_bytes = coalesce_bad_bytes;
+            tokenize(scanner, [&](const token &next_token) {
+                kinds.push_back(uint8_t(next_token.kind));
+                offsets.push_back(line_start + uint64_t(next_token.position - line.data()));
+                lengths.push_back(uint32_t(next_token.length));
+            });
+            line_start = line_end + 1;
+        }
+    }
+};
+
+// A read-only one-dimensional array that owns a std::vector and exports it
+// through the buffer protocol.
+struct token_array_object {
+    PyObject_HEAD
+    void* values;             // The std::vector<T>
+    void (*release)(void*);   // Deletes it
+    char* data;
+    Py_ssize_t length;
+    Py_ssize_t item_size;
+    const char* format;
+};
+
+static void token_array_dealloc(PyObject* self) {
+    auto array = reinterpret_cast<token_array_object*>(self);
+    if (array->values != nullptr)
+        array->release(array->values);
+    PyTypeObject* type = Py_TYPE(self);
+    type->tp_free(self);
+    Py_DECREF(type);
+}
+
+static int token_array_getbuffer(PyObject* self, Py_buffer* view, int flags) {
+    auto array = reinterpret_cast<token_array_object*>(self);
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "token arrays are read-only");
+        view->obj = nullptr;
+        return -1;
+    }
+    Py_INCREF(self);
+    view->obj = self;
+    view->buf = array->data;
+    view->len = array->length * array->item_size;
+    view->readonly = 1;
+    view->itemsize = array->item_size;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(array->format) : nullptr;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &array->length : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &array->item_size : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+static Py_ssize_t token_array_length(PyObject* self) {
+    return reinterpret_cast<token_array_object*>(self)->length;
+}
+
+static PyType_Slot token_array_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void*>(token_array_dealloc)},
+    {Py_bf_getbuffer, reinterpret_cast<void*>(token_array_getbuffer)},
+    {Py_sq_length, reinterpret_cast<void*>(token_array_length)},
+    {Py_tp_doc, const_cast<char*>("Read-only token field array, exported through the buffer protocol.")},
+    {0, nullptr}
+};
+
+static PyType_Spec token_array_spec = {
+    "tokenizer.TokenArray",
+    sizeof(token_array_object),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    token_array_slots
+};
+
+static PyTypeObject* token_array_type = nullptr;
+
+// Moves `values` into a new array object, or returns nullptr with an error set.
+template <typename T>
+static PyObject* make_token_array(std::vector<T> &values, const char* format) {
+    auto array = PyObject_New(token_array_object, token_array_type);
+    if (array == nullptr)
+        return nullptr;
+    array->values = nullptr;
+    try {
+        auto owned = new std::vector<T>(std::move(values));
+        array->values = owned;
+        array->release = [](void* values) { delete static_cast<std::vector<T>*>(values); };
+        array->data = reinterpret_cast<char*>(owned->data());
+        array->length = Py_ssize_t(owned->size());
+        array->item_size = sizeof(T);
+        array->format = format;
+    }
+    catch (const std::bad_alloc &) {
+        Py_DECREF(array);
+        return PyErr_NoMemory();
+    }
+    return reinterpret_cast<PyObject*>(array);
+}
+
+static PyObject* tokenize_function(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"data", "coalesce_bad_bytes", nullptr};
+    Py_buffer input;
+    int coalesce_bad_bytes = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "y*|p:tokenize", const_cast<char**>(keywords), &input, &coalesce_bad_bytes))
+        return nullptr;
+
+    // The buffer stays exported, so its memory cannot move or be freed
+    // while other threads run.
+    token_columns columns;
+    bool out_of_memory = false;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        columns.lex(std::string_view(static_cast<const char*>(input.buf), size_t(input.len)), coalesce_bad_bytes != 0);
+    }
+    catch (const std::bad_alloc &) {
+        out_of_memory = true;
+    }
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&input);
+    if (out_of_memory)
+        return PyErr_NoMemory();
+
+    PyObject* kinds = make_token_array(columns.kinds, "B");
+    PyObject* offsets = kinds != nullptr ? make_token_array(columns.offsets, "Q") : nullptr;
+    PyObject* lengths = offsets != nullptr ? make_token_array(columns.lengths, "I") : nullptr;
+    if (lengths == nullptr) {
+        Py_XDECREF(kinds);
+        Py_XDECREF(offsets);
+        return nullptr;
+    }
+    return Py_BuildValue("(NNN)", kinds, offsets, lengths);
+}
+
+static PyMethodDef module_methods[] = {
+    {"tokenize", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)(void)>(tokenize_function)), METH_VARARGS | METH_KEYWORDS,
+     "tokenize(data, coalesce_bad_bytes=False) -> (kinds, offsets, lengths)\n\n"
+     "Tokenizes a bytes-like object. Returns three read-only buffer protocol\n"
+     "arrays with one item per token: kind (uint8, see the *_KIND constants),\n"
+     "byte offset in data (uint64) and byte length (uint32). Every line,\n"
+     "including the last, ends with an EOL_KIND token."},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyModuleDef module_definition = {
+    PyModuleDef_HEAD_INIT,
+    "tokenizer",
+    "Fast tokenizer returning token arrays.",
+    -1,
+    module_methods,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr
+};
+
+PyMODINIT_FUNC PyInit_tokenizer() {
+    token_array_type = reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&token_array_spec));
+    if (token_array_type == nullptr)
+        return nullptr;
+
+    PyObject* module = PyModule_Create(&module_definition);
+    if (module == nullptr)
+        return nullptr;
+    if (PyModule_AddIntConstant(module, "PUNCTUATION_KIND", token::punctuation_kind) < 0 ||
+        PyModule_AddIntConstant(module, "NUMBER_KIND", token::number_kind) < 0 ||
+        PyModule_AddIntConstant(module, "SYMBOL_KIND", token::symbol_kind) < 0 ||
+        PyModule_AddIntConstant(module, "EOL_KIND", token::eol_kind) < 0 ||
+        PyModule_AddIntConstant(module, "BAD_CHAR_KIND", token::bad_char_kind) < 0) {
+        Py_DECREF(module);
+        return nullptr;
+    }
+    Py_INCREF(token_array_type);
+    if (PyModule_AddObject(module, "TokenArray", reinterpret_cast<PyObject*>(token_array_type)) < 0) {
+        Py_DECREF(token_array_type);
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
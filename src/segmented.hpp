@@ -0,0 +1,130 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tokenizer.hpp"
+
+// Tokenizes text stored as a sequence of pieces (a rope or piece table)
+// without flattening it. Tokens inside one piece point into that piece. A
+// token that may continue into the next piece is lexed again from a small
+// scratch copy of the bytes around the boundary; its position then points
+// into the scratch copy and is only valid until the next call.
+struct segmented_tokenizer {
+    // Bytes the scanner may inspect past the end of a token before deciding
+    // it ends there: at most one UTF8 sequence.
+    static const size_t lookahead = 4;
+
+    const std::string_view* pieces = nullptr;
+    size_t piece_count = 0;
+    size_t last_piece = 0; // Index of the last non-empty piece
+
+    size_t piece_index = 0;
+    size_t piece_offset = 0; // Offset of the current piece in the whole input
+    const char* position = nullptr;
+    size_t column = 1;
+
+    bool coalesce_bad_bytes = false;
+
+    // Offset of the last returned token in the whole input
+    size_t offset = 0;
+
+    std::string scratch;
+
+    // The pieces must outlive the tokenizer.
+    static segmented_tokenizer from_pieces(const std::vector<std::string_view> &pieces) {
+        segmented_tokenizer result;
+        result.pieces = pieces.data();
+        result.piece_count = pieces.size();
+        for (size_t i = 0; i < pieces.size(); i++) {
+            if (!pieces[i].empty())
+                result.last_piece = i;
+        }
+        if (!pieces.empty())
+            result.position = pieces[0].data();
+        return result;
+    }
+
+    token next_token() {
+        while (piece_index < piece_count) {
+            std::string_view piece = pieces[piece_index];
+            const char* piece_end = piece.data() + piece.size();
+            tokenizer scanner = {position, piece_end, 1, column};
+            scanner.coalesce_bad_bytes = coalesce_bad_bytes;
+            token tkn = scanner.next_token();
+            bool more_pieces = piece_index < last_piece;
+
+            if (tkn.kind == token::eol_kind) {
+                column = scanner.column;
+                if (!more_pieces) {
+                    offset = piece_offset + piece.size();
+                    return tkn;
+                }
+                piece_offset += piece.size();
+                position = pieces[++piece_index].data();
+                continue;
+            }
+
+            offset = piece_offset + (tkn.position - piece.data());
+            // Everything the scanner looked at to end the token was inside
+            // this piece, so the token is final.
+            if (!more_pieces || size_t(piece_end - scanner.position) >= lookahead) {
+                position = scanner.position;
+                column = scanner.column;
+                return tkn;
+            }
+            return next_straddling_token(tkn);
+        }
+
+        static const char empty[] = "";
+        return {token::eol_kind, empty, 1, column, 1};
+    }
+
+    // Lexes a token starting in the current piece from a scratch copy that
+    // grows into the following pieces until the token's end is certain.
+    token next_straddling_token(const token &partial) {
+        std::string_view piece = pieces[piece_index];
+        size_t start = partial.position - piece.data();
+        scratch.assign(partial.position, piece.size() - start);
+
+        size_t next_piece = piece_index + 1;
+        size_t next_offset = 0;
+        size_t chunk = 64;
+        while (true) {
+            size_t wanted = scratch.size() + chunk;
+            while (scratch.size() < wanted && next_piece <= last_piece) {
+                std::string_view next = pieces[next_piece].substr(next_offset, wanted - scratch.size());
+                scratch.append(next);
+                next_offset += next.size();
+                if (next_offset == pieces[next_piece].size()) {
+                    next_piece++;
+                    next_offset = 0;
+                }
+            }
+
+            auto scanner = tokenizer::from_string(scratch);
+            scanner.column = partial.column;
+            scanner.coalesce_bad_bytes = coalesce_bad_bytes;
+            token tkn = scanner.next_token();
+            size_t consumed = scanner.position - scratch.data();
+            if (next_piece > last_piece || scratch.size() - consumed >= lookahead) {
+                advance(start + consumed);
+                column = scanner.column;
+                return tkn;
+            }
+            // Optimization(sorgre): Doubling keeps very long tokens linear.
+            chunk *= 2;
+        }
+    }
+
+    // Moves to `skip` bytes past the start of the current piece.
+    void advance(size_t skip) {
+        while (skip > pieces[piece_index].size()) {
+            skip -= pieces[piece_index].size();
+            piece_offset += pieces[piece_index].size();
+            piece_index++;
+        }
+        position = pieces[piece_index].data() + skip;
+    }
+};
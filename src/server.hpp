@@ -0,0 +1,464 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "batch.hpp"
+
+// Binary token format: fixed size records, host byte order.
+struct wire_token {
+    uint32_t offset; // Bytes from the start of the buffer
+    uint32_t length;
+    uint32_t column; // From 1, in the token's line
+    uint8_t kind;    // token::kind_type
+    uint8_t error;   // token::error_type
+    uint16_t reserved;
+};
+static_assert(sizeof(wire_token) == 16, "wire_token is part of the protocol");
+
+// Protocol, over a Unix stream socket, all integers 32-bit host order:
+//   request:  size, then `size` bytes: buffer count, then per buffer its
+//             length and bytes
+//   response: size, then `size` bytes: per buffer its token count and
+//             wire_token records
+// Buffers hold lines separated by '\n'. Every line, the last one too, ends
+// with an end of line token. Requests on one connection are answered in order.
+
+// Appends a uint32 in host order.
+void append_uint32(std::string &out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Reads a uint32 from the front of `in`, or returns false if it is too short.
+bool take_uint32(std::string_view &in, uint32_t &value) {
+    if (in.size() < sizeof(value))
+        return false;
+    std::memcpy(&value, in.data(), sizeof(value));
+    in.remove_prefix(sizeof(value));
+    return true;
+}
+
+// Sends all of `data`, or returns false.
+bool send_all(int fd, std::string_view data) {
+    while (!data.empty()) {
+        ssize_t sent = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+            continue;
+        if (sent <= 0)
+            return false;
+        data.remove_prefix(sent);
+    }
+    return true;
+}
+
+// Receives exactly `size` bytes into `data`, or returns false.
+bool receive_all(int fd, char* data, size_t size) {
+    while (size != 0) {
+        ssize_t received = ::recv(fd, data, size, 0);
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received <= 0)
+            return false;
+        data += received;
+        size -= received;
+    }
+    return true;
+}
+
+// Long-lived tokenizer daemon. One event loop thread accepts connections and
+// reads requests; a pool of workers lexes and answers them. A worker takes
+// every queued request up to `max_batch_bytes` and lexes all their lines in
+// one token_batch, so many small requests cost one batch setup.
+struct token_server {
+    static const size_t max_request_size = 64 << 20;
+    static const size_t max_batch_bytes = 1 << 20;
+    static const size_t read_size = 64 << 10;
+
+    struct connection {
+        int fd;
+        std::string input; // Read but not yet parsed
+        bool busy = false;    // Its request is with the workers; not polled meanwhile
+        bool closing = false; // Shut down, closed once not busy
+    };
+
+    struct request {
+        int fd;
+        std::string body;
+    };
+
+    int listen_fd = -1;
+    int wake_pipe[2] = {-1, -1}; // Workers and stop() wake the event loop
+    std::string path;
+    std::vector<std::unique_ptr<connection>> connections;
+
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::deque<request> queue;
+    std::vector<int> answered; // Connections whose request is done
+    bool stopping = false;
+
+    ~token_server() {
+        for (auto &client : connections)
+            ::close(client->fd);
+        for (int fd : {listen_fd, wake_pipe[0], wake_pipe[1]})
+            if (fd >= 0)
+                ::close(fd);
+        if (listen_fd >= 0)
+            ::unlink(path.c_str());
+    }
+
+    // Returns nullptr, or why the socket could not be set up. A stale socket
+    // file at `socket_path`, one nobody listens on, is replaced; anything
+    // else there is left alone.
+    const char* listen(const char* socket_path) {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (std::strlen(socket_path) >= sizeof(address.sun_path))
+            return "socket path too long";
+        std::strcpy(address.sun_path, socket_path);
+        // Non-blocking: the event loop drains it without waiting, and a wake
+        // up that finds it full is not needed anyway.
+        if (::pipe(wake_pipe) != 0)
+            return std::strerror(errno);
+        for (int fd : wake_pipe)
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd < 0)
+            return std::strerror(errno);
+        if (const char* error = remove_stale_socket(address)) {
+            ::close(listen_fd);
+            listen_fd = -1;
+            return error;
+        }
+        if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listen_fd, 128) != 0) {
+            const char* error = std::strerror(errno);
+            ::close(listen_fd);
+            listen_fd = -1;
+            return error;
+        }
+        path = socket_path;
+        return nullptr;
+    }
+
+    // Returns nullptr if nothing is at the address or a dead socket file was
+    // removed, otherwise why the path cannot be used.
+    static const char* remove_stale_socket(const sockaddr_un &address) {
+        struct stat status;
+        if (::lstat(address.sun_path, &status) != 0)
+            return errno == ENOENT ? nullptr : std::strerror(errno);
+        if (!S_ISSOCK(status.st_mode))
+            return "path exists and is not a socket";
+
+        int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (probe < 0)
+            return std::strerror(errno);
+        int result = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+        int error = errno;
+        ::close(probe);
+        if (result == 0)
+            return "another server is listening on the socket";
+        if (error != ECONNREFUSED)
+            return std::strerror(error);
+        if (::unlink(address.sun_path) != 0 && errno != ENOENT)
+            return std::strerror(errno);
+        return nullptr;
+    }
+
+    // Serves until stop() is called.
+    void run(size_t worker_count) {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < std::max<size_t>(worker_count, 1); i++)
+            workers.emplace_back(&token_server::serve_requests, this);
+
+        std::vector<pollfd> polled;
+        std::vector<connection*> polled_connections;
+        while (true) {
+            polled.assign({{listen_fd, POLLIN, 0}, {wake_pipe[0], POLLIN, 0}});
+            polled_connections.clear();
+            for (auto &client : connections) {
+                if (!client->busy) {
+                    polled.push_back({client->fd, POLLIN, 0});
+                    polled_connections.push_back(client.get());
+                }
+            }
+            if (::poll(polled.data(), polled.size(), -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+
+            if (polled[1].revents & POLLIN) {
+                char drained[64];
+                while (::read(wake_pipe[0], drained, sizeof(drained)) > 0) {}
+                std::vector<int> done;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (stopping)
+                        break;
+                    done.swap(answered);
+                }
+                for (auto &client : connections) {
+                    if (std::find(done.begin(), done.end(), client->fd) != done.end()) {
+                        client->busy = false;
+                        // A pipelined request may already be buffered
+                        take_request(*client);
+                    }
+                }
+            }
+            for (size_t i = 2; i < polled.size(); i++) {
+                if (polled[i].revents != 0)
+                    read_requests(*polled_connections[i - 2]);
+            }
+            if (polled[0].revents & POLLIN) {
+                int client = ::accept(listen_fd, nullptr, nullptr);
+                if (client >= 0)
+                    connections.push_back(std::make_unique<connection>(connection{client, {}}));
+            }
+            close_finished();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        work_ready.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    // Thread safe: makes run() return once the workers are done.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        char wake = 0;
+        (void)!::write(wake_pipe[1], &wake, 1);
+    }
+
+    void read_requests(connection &client) {
+        size_t old_size = client.input.size();
+        client.input.resize(old_size + read_size);
+        ssize_t received = ::recv(client.fd, &client.input[old_size], read_size, 0);
+        client.input.resize(old_size + std::max<ssize_t>(received, 0));
+        if (received <= 0) {
+            if (received < 0 && errno == EINTR)
+                return;
+            client.closing = true;
+            return;
+        }
+        take_request(client);
+    }
+
+    // Queues the first complete request in `client.input`, if any.
+    void take_request(connection &client) {
+        if (client.busy || client.closing)
+            return;
+        std::string_view input = client.input;
+        uint32_t size;
+        if (!take_uint32(input, size))
+            return;
+        if (size > max_request_size) {
+            client.closing = true;
+            return;
+        }
+        if (input.size() < size)
+            return;
+        request next = {client.fd, std::string(input.substr(0, size))};
+        client.input.erase(0, sizeof(size) + size);
+        client.busy = true;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(std::move(next));
+        }
+        work_ready.notify_one();
+    }
+
+    void close_finished() {
+        size_t kept = 0;
+        for (auto &client : connections) {
+            if (client->closing && !client->busy)
+                ::close(client->fd);
+            else
+                connections[kept++] = std::move(client);
+        }
+        connections.resize(kept);
+    }
+
+    void serve_requests() {
+        token_batch lexer;
+        std::vector<request> batch;
+        std::vector<std::string_view> lines;
+        std::vector<size_t> buffer_lines; // Per buffer of the batch: its first line
+        std::vector<const char*> buffer_starts;
+        std::vector<size_t> request_buffers; // Per request: one past its last buffer, SIZE_MAX if malformed
+        std::string response;
+
+        while (true) {
+            batch.clear();
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_ready.wait(lock, [&]() { return stopping || !queue.empty(); });
+                if (stopping)
+                    return;
+                size_t batch_bytes = 0;
+                while (!queue.empty() && (batch.empty() || batch_bytes + queue.front().body.size() <= max_batch_bytes)) {
+                    batch_bytes += queue.front().body.size();
+                    batch.push_back(std::move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+
+            lines.clear();
+            buffer_lines.clear();
+            buffer_starts.clear();
+            request_buffers.clear();
+            for (const auto &next : batch)
+                request_buffers.push_back(split_request(next.body, lines, buffer_lines, buffer_starts) ? buffer_starts.size() : SIZE_MAX);
+            buffer_lines.push_back(lines.size());
+            lexer.tokenize(lines.data(), lines.size());
+
+            size_t first_buffer = 0;
+            for (size_t r = 0; r < batch.size(); r++) {
+                // A malformed request ends its connection; the event loop
+                // then reads end of file and closes it.
+                if (request_buffers[r] == SIZE_MAX) {
+                    ::shutdown(batch[r].fd, SHUT_RDWR);
+                    continue;
+                }
+                response.assign(sizeof(uint32_t), '\0');
+                for (size_t b = first_buffer; b < request_buffers[r]; b++)
+                    append_buffer_tokens(response, lexer, buffer_lines[b], buffer_lines[b + 1], buffer_starts[b]);
+                uint32_t size = uint32_t(response.size() - sizeof(uint32_t));
+                std::memcpy(&response[0], &size, sizeof(size));
+                if (!send_all(batch[r].fd, response))
+                    ::shutdown(batch[r].fd, SHUT_RDWR);
+                first_buffer = request_buffers[r];
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (const auto &next : batch)
+                    answered.push_back(next.fd);
+            }
+            char wake = 0;
+            (void)!::write(wake_pipe[1], &wake, 1);
+        }
+    }
+
+    // Appends the lines of every buffer in `body`. Returns false, adding
+    // nothing, if the body is malformed.
+    static bool split_request(std::string_view body, std::vector<std::string_view> &lines,
+                              std::vector<size_t> &buffer_lines, std::vector<const char*> &buffer_starts) {
+        size_t old_lines = lines.size();
+        size_t old_buffers = buffer_starts.size();
+        uint32_t count;
+        bool valid = take_uint32(body, count);
+        for (uint32_t b = 0; valid && b < count; b++) {
+            uint32_t length;
+            valid = take_uint32(body, length) && length <= body.size();
+            if (!valid)
+                break;
+            std::string_view buffer = body.substr(0, length);
+            body.remove_prefix(length);
+            buffer_lines.push_back(lines.size());
+            buffer_starts.push_back(buffer.data());
+            while (!buffer.empty()) {
+                size_t line_end = std::min(buffer.find('\n'), buffer.size());
+                lines.push_back(buffer.substr(0, line_end));
+                buffer.remove_prefix(std::min(line_end + 1, buffer.size()));
+            }
+        }
+        if (valid && body.empty())
+            return true;
+        lines.resize(old_lines);
+        buffer_lines.resize(old_buffers);
+        buffer_starts.resize(old_buffers);
+        return false;
+    }
+
+    // Appends the token count and tokens of lines [first_line, last_line).
+    static void append_buffer_tokens(std::string &out, const token_batch &lexer, size_t first_line, size_t last_line, const char* buffer_start) {
+        size_t first = lexer.line_tokens[first_line];
+        size_t last = lexer.line_tokens[last_line];
+        append_uint32(out, uint32_t(last - first));
+        size_t at = out.size();
+        out.resize(at + (last - first) * sizeof(wire_token));
+        for (size_t i = first; i < last; i++, at += sizeof(wire_token)) {
+            const token &tkn = lexer.tokens[i];
+            wire_token record = {uint32_t(tkn.position - buffer_start), uint32_t(tkn.length), uint32_t(tkn.column), uint8_t(tkn.kind), uint8_t(tkn.error), 0};
+            std::memcpy(&out[at], &record, sizeof(record));
+        }
+    }
+};
+
+// Blocking client for a token_server.
+struct token_client {
+    int fd = -1;
+    std::string request;
+    std::string response;
+
+    ~token_client() {
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    // Returns nullptr, or why it could not connect.
+    const char* connect(const char* socket_path) {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (std::strlen(socket_path) >= sizeof(address.sun_path))
+            return "socket path too long";
+        std::strcpy(address.sun_path, socket_path);
+        fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+            return std::strerror(errno);
+        return nullptr;
+    }
+
+    // Tokens of every buffer, or false if the server could not be reached.
+    bool tokenize(const std::vector<std::string_view> &buffers, std::vector<std::vector<wire_token>> &tokens) {
+        request.assign(sizeof(uint32_t), '\0');
+        append_uint32(request, uint32_t(buffers.size()));
+        for (auto buffer : buffers) {
+            append_uint32(request, uint32_t(buffer.size()));
+            request.append(buffer);
+        }
+        uint32_t size = uint32_t(request.size() - sizeof(uint32_t));
+        std::memcpy(&request[0], &size, sizeof(size));
+        if (!send_all(fd, request) || !receive_all(fd, reinterpret_cast<char*>(&size), sizeof(size)))
+            return false;
+        response.resize(size);
+        if (!receive_all(fd, &response[0], size))
+            return false;
+
+        std::string_view body = response;
+        tokens.resize(buffers.size());
+        for (auto &buffer_tokens : tokens) {
+            uint32_t count;
+            if (!take_uint32(body, count) || body.size() < count * sizeof(wire_token))
+                return false;
+            buffer_tokens.resize(count);
+            if (count != 0)
+                std::memcpy(buffer_tokens.data(), body.data(), count * sizeof(wire_token));
+            body.remove_prefix(count * sizeof(wire_token));
+        }
+        return body.empty();
+    }
+};
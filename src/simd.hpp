@@ -0,0 +1,279 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define TOKENIZER_X86_DISPATCH 1
+#endif
+
+// Byte classification kernels, compiled for several instruction set levels.
+// The best level the CPU supports is picked once, on first use, through
+// cpuid; TOKENIZER_ISA=scalar|sse42|avx2|avx512 in the environment forces a
+// level for testing (a level the CPU lacks falls back to the best it has).
+//
+// Every kernel returns the length of the longest prefix of [p, p + n) whose
+// bytes are all in a class, and never reads outside that range.
+enum byte_class {
+    identifier_bytes, // [A-Za-z0-9_]
+    ascii_bytes,      // 0x00-0x7f
+    non_lead_bytes,   // Bytes that never start valid UTF8: 0x80-0xc1, 0xf5-0xff
+};
+
+// One bit per byte of a 64-byte block, set when the byte is in the class.
+struct block_classes {
+    uint64_t space;      // ' ', '\t'
+    uint64_t identifier; // [A-Za-z0-9_]
+    uint64_t digit;      // [0-9]
+    uint64_t non_ascii;  // 0x80-0xff
+};
+
+struct simd_kernels {
+    const char* name;
+    size_t (*identifier_run)(const char* p, size_t n);
+    size_t (*non_lead_run)(const char* p, size_t n);
+    // Classifies the 64 bytes at p, which must all be readable.
+    void (*classify_block)(const char* p, block_classes &classes);
+};
+
+template <byte_class Class>
+constexpr bool in_byte_class(uint8_t byte) {
+    switch (Class) {
+        case identifier_bytes:
+            return
+                (uint8_t((byte | 0x20) - 'a') < 26) ||
+                (uint8_t(byte - '0') < 10) ||
+                byte == '_';
+        case ascii_bytes:
+            return byte < 0x80;
+        case non_lead_bytes:
+            return (byte >= 0x80 && byte <= 0xc1) || byte >= 0xf5;
+    }
+    return false;
+}
+
+template <byte_class Class>
+size_t scalar_run(const char* p, size_t n) {
+    size_t i = 0;
+    while (i < n && in_byte_class<Class>(uint8_t(p[i])))
+        i++;
+    return i;
+}
+
+void scalar_classify_block(const char* p, block_classes &classes) {
+    classes = {};
+    for (size_t i = 0; i < 64; i++) {
+        uint8_t byte = uint8_t(p[i]);
+        uint64_t bit = uint64_t(1) << i;
+        if (byte == ' ' || byte == '\t')
+            classes.space |= bit;
+        if (in_byte_class<identifier_bytes>(byte))
+            classes.identifier |= bit;
+        if (uint8_t(byte - '0') < 10)
+            classes.digit |= bit;
+        if (!in_byte_class<ascii_bytes>(byte))
+            classes.non_ascii |= bit;
+    }
+}
+
+#ifdef TOKENIZER_X86_DISPATCH
+
+// x <= bound, for unsigned bytes
+#define TOKENIZER_SIMD_LE(width, x, bound) \
+    _mm##width##_cmpeq_epi8(_mm##width##_min_epu8((x), (bound)), (x))
+// lo <= x <= hi, for unsigned bytes
+#define TOKENIZER_SIMD_IN_RANGE(width, x, lo, hi) \
+    TOKENIZER_SIMD_LE(width, _mm##width##_sub_epi8((x), _mm##width##_set1_epi8(char(lo))), _mm##width##_set1_epi8(char((hi) - (lo))))
+
+template <byte_class Class>
+__attribute__((target("sse4.2")))
+size_t sse42_run(const char* p, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i in_class;
+        if (Class == identifier_bytes) {
+            in_class = _mm_or_si128(
+                _mm_or_si128(
+                    TOKENIZER_SIMD_IN_RANGE(, _mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z'),
+                    TOKENIZER_SIMD_IN_RANGE(, x, '0', '9')
+                ),
+                _mm_cmpeq_epi8(x, _mm_set1_epi8('_'))
+            );
+        }
+        else {
+            in_class = _mm_or_si128(
+                TOKENIZER_SIMD_IN_RANGE(, x, 0x80, 0xc1),
+                TOKENIZER_SIMD_IN_RANGE(, x, 0xf5, 0xff)
+            );
+        }
+        uint32_t outside = ~uint32_t(_mm_movemask_epi8(in_class)) & 0xffff;
+        if (outside != 0)
+            return i + __builtin_ctz(outside);
+    }
+    return i + scalar_run<Class>(p + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+void sse42_classify_block(const char* p, block_classes &classes) {
+    classes = {};
+    for (size_t i = 0; i < 64; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i digit = TOKENIZER_SIMD_IN_RANGE(, x, '0', '9');
+        __m128i identifier = _mm_or_si128(
+            _mm_or_si128(TOKENIZER_SIMD_IN_RANGE(, _mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z'), digit),
+            _mm_cmpeq_epi8(x, _mm_set1_epi8('_'))
+        );
+        __m128i space = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(x, _mm_set1_epi8('\t')));
+        classes.space |= uint64_t(uint16_t(_mm_movemask_epi8(space))) << i;
+        classes.identifier |= uint64_t(uint16_t(_mm_movemask_epi8(identifier))) << i;
+        classes.digit |= uint64_t(uint16_t(_mm_movemask_epi8(digit))) << i;
+        classes.non_ascii |= uint64_t(uint16_t(_mm_movemask_epi8(x))) << i;
+    }
+}
+
+template <byte_class Class>
+__attribute__((target("avx2")))
+size_t avx2_run(const char* p, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i in_class;
+        if (Class == identifier_bytes) {
+            in_class = _mm256_or_si256(
+                _mm256_or_si256(
+                    TOKENIZER_SIMD_IN_RANGE(256, _mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 'z'),
+                    TOKENIZER_SIMD_IN_RANGE(256, x, '0', '9')
+                ),
+                _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_'))
+            );
+        }
+        else {
+            in_class = _mm256_or_si256(
+                TOKENIZER_SIMD_IN_RANGE(256, x, 0x80, 0xc1),
+                TOKENIZER_SIMD_IN_RANGE(256, x, 0xf5, 0xff)
+            );
+        }
+        uint32_t outside = ~uint32_t(_mm256_movemask_epi8(in_class));
+        if (outside != 0)
+            return i + __builtin_ctz(outside);
+    }
+    return i + sse42_run<Class>(p + i, n - i);
+}
+
+__attribute__((target("avx2")))
+void avx2_classify_block(const char* p, block_classes &classes) {
+    classes = {};
+    for (size_t i = 0; i < 64; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i digit = TOKENIZER_SIMD_IN_RANGE(256, x, '0', '9');
+        __m256i identifier = _mm256_or_si256(
+            _mm256_or_si256(TOKENIZER_SIMD_IN_RANGE(256, _mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 'z'), digit),
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_'))
+        );
+        __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t')));
+        classes.space |= uint64_t(uint32_t(_mm256_movemask_epi8(space))) << i;
+        classes.identifier |= uint64_t(uint32_t(_mm256_movemask_epi8(identifier))) << i;
+        classes.digit |= uint64_t(uint32_t(_mm256_movemask_epi8(digit))) << i;
+        classes.non_ascii |= uint64_t(uint32_t(_mm256_movemask_epi8(x))) << i;
+    }
+}
+
+template <byte_class Class>
+__attribute__((target("avx512f,avx512bw")))
+size_t avx512_run(const char* p, size_t n) {
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i x = _mm512_loadu_si512(p + i);
+        __mmask64 in_class;
+        if (Class == identifier_bytes) {
+            __m512i lower = _mm512_sub_epi8(_mm512_or_si512(x, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+            __m512i digit = _mm512_sub_epi8(x, _mm512_set1_epi8('0'));
+            in_class =
+                _mm512_cmple_epu8_mask(lower, _mm512_set1_epi8(25)) |
+                _mm512_cmple_epu8_mask(digit, _mm512_set1_epi8(9)) |
+                _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8('_'));
+        }
+        else {
+            in_class =
+                _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, _mm512_set1_epi8(char(0x80))), _mm512_set1_epi8(0xc1 - 0x80)) |
+                _mm512_cmpge_epu8_mask(x, _mm512_set1_epi8(char(0xf5)));
+        }
+        uint64_t outside = ~uint64_t(in_class);
+        if (outside != 0)
+            return i + __builtin_ctzll(outside);
+    }
+    return i + avx2_run<Class>(p + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void avx512_classify_block(const char* p, block_classes &classes) {
+    __m512i x = _mm512_loadu_si512(p);
+    __m512i lower = _mm512_sub_epi8(_mm512_or_si512(x, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+    __mmask64 digit = _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, _mm512_set1_epi8('0')), _mm512_set1_epi8(9));
+    classes.space = _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8(' ')) | _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8('\t'));
+    classes.identifier =
+        _mm512_cmple_epu8_mask(lower, _mm512_set1_epi8(25)) | digit |
+        _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8('_'));
+    classes.digit = digit;
+    classes.non_ascii = _mm512_movepi8_mask(x);
+}
+
+#undef TOKENIZER_SIMD_IN_RANGE
+#undef TOKENIZER_SIMD_LE
+
+#endif
+
+const simd_kernels scalar_kernels = {
+    "scalar", scalar_run<identifier_bytes>, scalar_run<non_lead_bytes>,
+    scalar_classify_block
+};
+#ifdef TOKENIZER_X86_DISPATCH
+const simd_kernels sse42_kernels = {
+    "sse42", sse42_run<identifier_bytes>, sse42_run<non_lead_bytes>,
+    sse42_classify_block
+};
+const simd_kernels avx2_kernels = {
+    "avx2", avx2_run<identifier_bytes>, avx2_run<non_lead_bytes>,
+    avx2_classify_block
+};
+const simd_kernels avx512_kernels = {
+    "avx512", avx512_run<identifier_bytes>, avx512_run<non_lead_bytes>,
+    avx512_classify_block
+};
+#endif
+
+// The kernels for the best instruction set level below or at `requested`
+// that this CPU supports. An empty request means the best overall.
+const simd_kernels &select_kernels(std::string_view requested) {
+#ifdef TOKENIZER_X86_DISPATCH
+    __builtin_cpu_init();
+    int level = 3;
+    if (requested == "scalar")
+        level = 0;
+    else if (requested == "sse42")
+        level = 1;
+    else if (requested == "avx2")
+        level = 2;
+
+    if (level >= 3 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        return avx512_kernels;
+    if (level >= 2 && __builtin_cpu_supports("avx2"))
+        return avx2_kernels;
+    if (level >= 1 && __builtin_cpu_supports("sse4.2"))
+        return sse42_kernels;
+#else
+    (void)requested;
+#endif
+    return scalar_kernels;
+}
+
+const simd_kernels &simd() {
+    static const simd_kernels &selected = select_kernels(
+        std::getenv("TOKENIZER_ISA") != nullptr ? std::getenv("TOKENIZER_ISA") : ""
+    );
+    return selected;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include "compile_time.hpp"
+
+// Hot path counters. They are compiled in with -DTOKENIZER_STATS; otherwise
+// TOKENIZER_STAT_ADD expands to nothing and the scanner is unchanged.
+//
+// Each thread counts into its own block. A block has a single writer, so an
+// increment is a relaxed load and store rather than a locked add, and
+// stats_snapshot() can still read it from another thread.
+enum stats_counter {
+    stat_bytes_scanned,
+    stat_tokens,                     // One counter per token kind, in kind order
+    stat_tokens_end = stat_tokens + 5,
+    stat_ascii_fast_path = stat_tokens_end,
+    stat_utf8_slow_path,
+    stat_table_memo_hits,            // Found in the last matched range, no lookup
+    stat_table_lookups,
+    stat_table_range_steps,
+    stat_bad_chars,
+    stat_utf8_errors,
+    stats_counter_count
+};
+
+struct tokenizer_stats {
+    uint64_t counters[stats_counter_count] = {};
+
+    uint64_t operator [] (size_t counter) const {
+        return counters[counter];
+    }
+
+    void merge(const tokenizer_stats &other) {
+        for (size_t i = 0; i < stats_counter_count; i++)
+            counters[i] += other.counters[i];
+    }
+};
+
+std::ostream& operator << (std::ostream& str, const tokenizer_stats &stats) {
+    static const char* kind_names[] = {"PCT", "NUM", "SYM", "EOL", "BAD"};
+
+    str << "bytes scanned:      " << stats[stat_bytes_scanned] << "\n";
+    for (size_t kind = 0; kind < stat_tokens_end - stat_tokens; kind++)
+        str << "tokens " << kind_names[kind] << ":         " << stats[stat_tokens + kind] << "\n";
+    str << "ASCII fast path:    " << stats[stat_ascii_fast_path] << "\n";
+    str << "UTF8 slow path:     " << stats[stat_utf8_slow_path] << "\n";
+    str << "range memo hits:    " << stats[stat_table_memo_hits];
+    if (stats[stat_table_memo_hits] + stats[stat_table_lookups] != 0)
+        str << " (" << 100.0 * double(stats[stat_table_memo_hits]) / double(stats[stat_table_memo_hits] + stats[stat_table_lookups]) << "%)";
+    str << "\n";
+    str << "table lookups:      " << stats[stat_table_lookups] << "\n";
+    str << "avg range scan:     ";
+    if (stats[stat_table_lookups] != 0)
+        str << double(stats[stat_table_range_steps]) / double(stats[stat_table_lookups]) << "\n";
+    else
+        str << "-\n";
+    str << "bad chars:          " << stats[stat_bad_chars] << "\n";
+    str << "UTF8 errors:        " << stats[stat_utf8_errors] << "\n";
+    return str;
+}
+
+struct stats_block;
+
+struct stats_registry {
+    std::mutex mutex;
+    std::vector<stats_block*> blocks;
+    tokenizer_stats retired; // Counts of threads that have exited
+
+    static stats_registry &instance() {
+        static stats_registry registry;
+        return registry;
+    }
+};
+
+struct stats_block {
+    std::atomic<uint64_t> counters[stats_counter_count] = {};
+
+    stats_block() {
+        auto &registry = stats_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.blocks.push_back(this);
+    }
+
+    ~stats_block() {
+        auto &registry = stats_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.retired.merge(snapshot());
+        for (auto &block : registry.blocks) {
+            if (block == this) {
+                block = registry.blocks.back();
+                registry.blocks.pop_back();
+                break;
+            }
+        }
+    }
+
+    void add(size_t counter, uint64_t count) {
+        auto &value = counters[counter];
+        value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    tokenizer_stats snapshot() const {
+        tokenizer_stats stats;
+        for (size_t i = 0; i < stats_counter_count; i++)
+            stats.counters[i] = counters[i].load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void reset() {
+        for (auto &value : counters)
+            value.store(0, std::memory_order_relaxed);
+    }
+};
+
+stats_block &thread_stats() {
+    static thread_local stats_block block;
+    return block;
+}
+
+// Sum of all threads, live and exited.
+tokenizer_stats stats_snapshot() {
+    auto &registry = stats_registry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    tokenizer_stats stats = registry.retired;
+    for (auto block : registry.blocks)
+        stats.merge(block->snapshot());
+    return stats;
+}
+
+#ifdef TOKENIZER_STATS
+#define TOKENIZER_STAT_ADD(counter, count) \
+    (constant_evaluation() ? void() : thread_stats().add((counter), (count)))
+#else
+#define TOKENIZER_STAT_ADD(counter, count) ((void)sizeof((counter) + (count)))
+#endif
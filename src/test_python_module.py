@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# Checks the Python extension (python_module.cpp) against the C++ tokenizer:
+# the kind, byte offset and length of every token must match what the
+# tokenizer daemon (--serve) reports for the same text.
+#
+# Run with the built extension on the module path, passing the tokenizer
+# binary:
+#   PYTHONPATH=. python3 src/test_python_module.py ./tokenizer
+import os
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+import tokenizer
+
+inputs = [
+    b"x = a * (b + 1.5) - 2\nfoo_bar(1, 2)\n\n  last",
+    "µ = 2π × r\n𝑥₁ ≠ ∑ αβγ\nnaïve_ünïcode\n".encode("utf-8"),
+    b"\xff\xfe ok \xc0\xaf\xed\xa0\x80 x\xe2\x82\n\x80\x80\x80\nend\xf5",
+    b"",
+    b"\n\n",
+    b"".join(b"line_%d = %d * \xc2\xb5 \xff\n" % (i, i) for i in range(5000)),
+]
+
+
+def read_exactly(connection, size):
+    data = b""
+    while len(data) < size:
+        chunk = connection.recv(size - len(data))
+        assert chunk, "daemon closed the connection"
+        data += chunk
+    return data
+
+
+# Tokens of each buffer as (kind, offset, length) lists, from the daemon.
+def daemon_tokens(connection, buffers):
+    body = struct.pack("=I", len(buffers))
+    for buffer in buffers:
+        body += struct.pack("=I", len(buffer)) + buffer
+    connection.sendall(struct.pack("=I", len(body)) + body)
+
+    size, = struct.unpack("=I", read_exactly(connection, 4))
+    response = read_exactly(connection, size)
+    result = []
+    position = 0
+    for _ in buffers:
+        count, = struct.unpack_from("=I", response, position)
+        position += 4
+        tokens = []
+        for _ in range(count):
+            offset, length, column, kind, error, reserved = struct.unpack_from("=IIIBBH", response, position)
+            position += 16
+            tokens.append((kind, offset, length))
+        result.append(tokens)
+    assert position == len(response)
+    return result
+
+
+def module_tokens(data, coalesce_bad_bytes=False):
+    kinds, offsets, lengths = tokenizer.tokenize(data, coalesce_bad_bytes=coalesce_bad_bytes)
+    assert len(kinds) == len(offsets) == len(lengths)
+    return list(zip(memoryview(kinds).tolist(), memoryview(offsets).tolist(), memoryview(lengths).tolist()))
+
+
+def bad_bytes(tokens):
+    return {offset + i for kind, offset, length in tokens if kind == tokenizer.BAD_CHAR_KIND for i in range(length)}
+
+
+def main():
+    binary = sys.argv[1]
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "tokenizer.sock")
+        daemon = subprocess.Popen([binary, "--serve", path])
+        try:
+            connection = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            for _ in range(100):
+                try:
+                    connection.connect(path)
+                    break
+                except (FileNotFoundError, ConnectionRefusedError):
+                    time.sleep(0.05)
+            else:
+                sys.exit("the daemon did not start")
+
+            expected = daemon_tokens(connection, inputs)
+            for data, tokens in zip(inputs, expected):
+                assert module_tokens(data) == tokens, data[:40]
+
+                # Coalescing merges bad bytes, the other tokens stay the same
+                coalesced = module_tokens(data, coalesce_bad_bytes=True)
+                assert [t for t in coalesced if t[0] != tokenizer.BAD_CHAR_KIND] == [t for t in tokens if t[0] != tokenizer.BAD_CHAR_KIND]
+                assert bad_bytes(coalesced) == bad_bytes(tokens)
+            connection.close()
+        finally:
+            daemon.terminate()
+            daemon.wait()
+
+    # Any bytes-like object is accepted; token arrays are read-only
+    kinds, offsets, lengths = tokenizer.tokenize(bytearray(b"a b"))
+    assert memoryview(kinds).tolist() == [tokenizer.SYMBOL_KIND, tokenizer.SYMBOL_KIND, tokenizer.EOL_KIND]
+    assert memoryview(offsets).format == "Q" and memoryview(lengths).format == "I"
+    assert memoryview(kinds).readonly
+    print("OK")
+
+
+main()
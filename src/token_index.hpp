@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "tokenizer.hpp"
+
+// Sparse index into the tokens of a large text: an entry every `byte_interval`
+// bytes and/or every `line_interval` lines (0 turns either off), each at a
+// token boundary. Scanning can resume from any entry, so the tokens near an
+// offset or line are found by lexing from the closest entry before it instead
+// of from the start.
+struct token_index {
+    struct entry {
+        uint64_t offset;  // Scan position in the text
+        uint64_t ordinal; // Number of tokens before it, end of line tokens included
+        uint64_t line;    // From 1
+        uint64_t column;  // From 1
+    };
+
+    uint64_t byte_interval = 0;
+    uint64_t line_interval = 0;
+    uint64_t text_size = 0;
+    std::vector<entry> entries;
+
+    // Last entry at or before `offset`. There is always one: the first entry is
+    // the start of the text, also recorded for an empty text and checked by
+    // load().
+    const entry &nearest_offset(uint64_t offset) const {
+        assert(!entries.empty());
+        auto after = std::upper_bound(entries.begin(), entries.end(), offset, [](uint64_t offset, const entry &e) {
+            return offset < e.offset;
+        });
+        return *(after - 1);
+    }
+
+    // Last entry on or before `line`.
+    const entry &nearest_line(uint64_t line) const {
+        assert(!entries.empty());
+        auto after = std::upper_bound(entries.begin(), entries.end(), line, [](uint64_t line, const entry &e) {
+            return line < e.line;
+        });
+        return *(after - 1);
+    }
+
+    // Binary layout: "TKIX", version, the three header fields and the entry
+    // count, then the entries, all as host order 64-bit words.
+    static constexpr char magic[4] = {'T', 'K', 'I', 'X'};
+    static constexpr uint32_t version = 1;
+
+    bool save(std::FILE* file) const {
+        uint64_t header[] = {byte_interval, line_interval, text_size, entries.size()};
+        return
+            std::fwrite(magic, sizeof(magic), 1, file) == 1 &&
+            std::fwrite(&version, sizeof(version), 1, file) == 1 &&
+            std::fwrite(header, sizeof(header), 1, file) == 1 &&
+            (entries.empty() || std::fwrite(entries.data(), sizeof(entry), entries.size(), file) == entries.size());
+    }
+
+    // Returns nullptr, or why the index could not be loaded.
+    const char* load(std::FILE* file) {
+        char file_magic[4];
+        uint32_t file_version = 0;
+        uint64_t header[4];
+        if (std::fread(file_magic, sizeof(file_magic), 1, file) != 1 || std::memcmp(file_magic, magic, sizeof(magic)) != 0)
+            return "not a token index";
+        if (std::fread(&file_version, sizeof(file_version), 1, file) != 1 || file_version != version)
+            return "unsupported token index version";
+        if (std::fread(header, sizeof(header), 1, file) != 1)
+            return "truncated token index";
+        // The count is checked against what the file holds before anything
+        // is allocated for it.
+        long here = std::ftell(file);
+        if (here >= 0 && std::fseek(file, 0, SEEK_END) == 0) {
+            long file_end = std::ftell(file);
+            if (file_end < here || std::fseek(file, here, SEEK_SET) != 0)
+                return "truncated token index";
+            if (header[3] > uint64_t(file_end - here) / sizeof(entry))
+                return "truncated token index";
+        }
+        // Not seekable: read in chunks, so memory only grows with the data
+        // actually there.
+        std::vector<entry> loaded;
+        while (loaded.size() < header[3]) {
+            size_t chunk = size_t(std::min<uint64_t>(header[3] - loaded.size(), 4096));
+            size_t old_size = loaded.size();
+            loaded.resize(old_size + chunk);
+            if (std::fread(loaded.data() + old_size, sizeof(entry), chunk, file) != chunk)
+                return "truncated token index";
+        }
+
+        // resume() and the nearest_*() searches rely on these
+        if (loaded.empty())
+            return "corrupt token index";
+        const entry &first = loaded[0];
+        if (first.offset != 0 || first.ordinal != 0 || first.line != 1 || first.column != 1)
+            return "corrupt token index";
+        for (size_t i = 1; i < loaded.size(); i++) {
+            const entry &e = loaded[i];
+            const entry &previous = loaded[i - 1];
+            if (e.offset > header[2] || e.line == 0 || e.column == 0)
+                return "corrupt token index";
+            if (e.offset < previous.offset || e.line < previous.line || e.ordinal < previous.ordinal)
+                return "corrupt token index";
+            // A new line starts past the '\n' of the previous one
+            if (e.line > previous.line && e.offset == previous.offset)
+                return "corrupt token index";
+        }
+
+        byte_interval = header[0];
+        line_interval = header[1];
+        text_size = header[2];
+        entries = std::move(loaded);
+        return nullptr;
+    }
+};
+
+// Scans a whole text line by line, numbering tokens and lines. With `index`
+// set, it records checkpoints as it goes.
+struct text_scanner {
+    std::string_view text; // Every line ends with '\n'
+    std::optional<tokenizer> current; // Scanner of the current line
+    uint64_t line = 1;
+    uint64_t ordinal = 0;
+
+    token_index* index = nullptr;
+    uint64_t next_offset_mark = 0;
+    uint64_t next_line_mark = 0;
+
+    static text_scanner from_text(std::string_view text, token_index* index = nullptr) {
+        assert(text.empty() || text.back() == '\n');
+        text_scanner result;
+        result.text = text;
+        result.index = index;
+        if (index != nullptr) {
+            index->text_size = text.size();
+            index->entries = {{0, 0, 1, 1}};
+            result.next_offset_mark = index->byte_interval != 0 ? index->byte_interval : UINT64_MAX;
+            result.next_line_mark = index->line_interval != 0 ? 1 + index->line_interval : UINT64_MAX;
+        }
+        result.start_line(0, 1);
+        return result;
+    }
+
+    // Continues a scan of `text` from an entry of `index`. Returns nothing if
+    // `text` cannot be the indexed text.
+    static std::optional<text_scanner> resume(std::string_view text, const token_index &index, const token_index::entry &from) {
+        if (text.size() != index.text_size || from.offset > text.size())
+            return std::nullopt;
+        text_scanner result;
+        result.text = text;
+        result.line = from.line;
+        result.ordinal = from.ordinal;
+        result.start_line(from.offset, from.column);
+        return result;
+    }
+
+    bool at_end() const {
+        return !current;
+    }
+
+    uint64_t offset() const {
+        return current->position - text.data();
+    }
+
+    void start_line(size_t offset, size_t column) {
+        if (offset == text.size()) {
+            current.reset();
+            return;
+        }
+        size_t line_end = text.find('\n', offset);
+        current.emplace(tokenizer::from_line(text.substr(offset, line_end - offset)));
+        current->column = column;
+    }
+
+    token next_token() {
+        assert(!at_end());
+        if (index != nullptr && (offset() >= next_offset_mark || line >= next_line_mark)) {
+            index->entries.push_back({offset(), ordinal, line, current->column});
+            next_offset_mark = index->byte_interval != 0 ? offset() + index->byte_interval : UINT64_MAX;
+            next_line_mark = index->line_interval != 0 ? line + index->line_interval : UINT64_MAX;
+        }
+
+        token tkn = current->next_token();
+        ordinal++;
+        if (tkn.kind == token::eol_kind) {
+            start_line(offset() + 1, 1);
+            line++;
+        }
+        return tkn;
+    }
+};
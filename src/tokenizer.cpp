@@ -1,4 +1,20 @@
 #include "tokenizer.hpp"
+#include "expression.hpp"
+#include "bytecode.hpp"
+#include "latency.hpp"
+#include "pipeline.hpp"
+#include "file_reader.hpp"
+#include "segmented.hpp"
+#include "batch.hpp"
+#include "frequency.hpp"
+#include "diff.hpp"
+#include "grep.hpp"
+#include "token_index.hpp"
+#include "server.hpp"
+
+#include <memory>
+#include <sstream>
+#include <tuple>
 
 template <int N>
 bool run_test(const std::string &input, const token (&output)[N]) {
@@ -10,7 +26,8 @@ bool run_test(const std::string &input, const token (&output)[N]) {
             (next_token.position != out.position) ||
             (next_token.length != out.length) ||
             (next_token.column != out.column) ||
-            (next_token.column_length != out.column_length)
+            (next_token.column_length != out.column_length) ||
+            (next_token.error != out.error)
         ) {
             std::cerr << "Expected token: " << out << std::endl;
             std::cerr << "got token: " << next_token << std::endl;
@@ -78,9 +95,1112 @@ void run_all_tests() {
             )
         );
     }
+    {
+        std::string input = "ab = 12 * (c3 + 4.5)";
+        std::string symbols, numbers;
+        size_t eol_count = 0;
+        tokenize<token::mask_of(token::symbol_kind)>(input, [&](const token &tkn) {
+            assert(tkn.kind == token::symbol_kind);
+            symbols += tkn.string_view();
+        });
+        tokenize<token::mask_of(token::number_kind) | token::mask_of(token::eol_kind)>(
+            input, [&](const token &tkn) {
+                if (tkn.kind == token::eol_kind) {
+                    assert(tkn.column == 1 + input.length());
+                    eol_count++;
+                    return;
+                }
+                assert(tkn.kind == token::number_kind);
+                numbers += tkn.string_view();
+            }
+        );
+        assert(symbols == "abc3");
+        assert(numbers == "124.5");
+        assert(eol_count == 1);
+    }
+    {
+        std::string input = "a = (1 + 2) * b";
+        token_stream<4> stream(tokenizer::from_string(input));
+        assert(stream.peek(2).string_view() == "(");
+        assert(stream.next().string_view() == "a");
+
+        // Backtrack inside the ring buffer
+        auto saved = stream.save();
+        assert(stream.next().string_view() == "=");
+        assert(stream.next().string_view() == "(");
+        stream.restore(saved);
+        assert(stream.peek(1).string_view() == "(");
+        assert(stream.next().string_view() == "=");
+
+        // Backtrack further than the ring buffer holds
+        saved = stream.save();
+        for (auto expected : {"(", "1", "+", "2", ")", "*"})
+            assert(stream.next().string_view() == expected);
+        stream.restore(saved);
+        assert(stream.next().string_view() == "(");
+        assert(stream.next().column == 6);
+
+        auto scanner = tokenizer::from_string(input);
+        auto scanner_saved = scanner.save();
+        scanner.next_token();
+        scanner.restore(scanner_saved);
+        assert(scanner.next_token().string_view() == "a");
+    }
+    {
+        expression_arena arena;
+        auto parse = [&](const std::string &input) {
+            arena.clear();
+            expression_parser parser(tokenizer::from_string(input), arena);
+            uint32_t root = parser.parse();
+            if (root == expression_node::no_node)
+                return std::string("error: ") + parser.error;
+            std::ostringstream str;
+            print_expression(str, arena, root);
+            return str.str();
+        };
+        assert(parse("x = a * (b + 1.5)") == "(= x (* a (+ b 1.5)))");
+        assert(arena.nodes.size() == 7);
+        assert(parse("1 - 2 - 3 * 4 / 5") == "(- (- 1 2) (/ (* 3 4) 5))");
+        assert(parse("a = b = -c * d") == "(= a (= b (* (- c) d)))");
+        assert(parse("(a + 1") == "error: expected ')'");
+        assert(parse("1 = a") == "error: left side of assignment must be a symbol");
+        assert(parse("a b") == "error: unexpected token after expression");
+        assert(parse("a +") == "error: unexpected end of line");
+    }
+    {
+        std::string source = "x = a * (b + 1.5) - -2 / 4.";
+        program prg;
+        assert(compile_program(source, prg) == nullptr);
+        assert(prg.variables.size() == 3);
+        assert(prg.variables[0] == "x" && prg.variables[1] == "a" && prg.variables[2] == "b");
+
+        const size_t rows = 1000; // Not a multiple of the batch size
+        std::vector<double> x(rows), a(rows), b(rows), result(rows);
+        for (size_t i = 0; i < rows; i++) {
+            a[i] = double(i);
+            b[i] = double(i % 7) - 3;
+        }
+        double* columns[] = {x.data(), a.data(), b.data()};
+        evaluate(prg, columns, rows, result.data());
+        for (size_t i = 0; i < rows; i++) {
+            double expected = a[i] * (b[i] + 1.5) - -2 / 4.;
+            assert(x[i] == expected);
+            assert(result[i] == expected);
+        }
+
+        // Variable names are owned by the program
+        std::fill(source.begin(), source.end(), ' ');
+        assert(prg.variables[0] == "x" && prg.variables[1] == "a" && prg.variables[2] == "b");
+
+        assert(compile_program("x = ", prg) != nullptr);
+
+        // Values read before an assignment in the same expression keep the
+        // old value, like evaluating one row at a time
+        for (auto [text, expected_y, expected_x] : {std::tuple<const char*, double, double>("y = x + (x = 1)", 6, 1),
+                                                    {"y = (x = 1) + x", 2, 1},
+                                                    {"y = (x = 2) * (x = 3) - x", 3, 3}}) {
+            assert(compile_program(text, prg) == nullptr);
+            assert(prg.variables[0] == "y" && prg.variables[1] == "x");
+            std::vector<double> y(rows), x(rows, 5);
+            double* columns[] = {y.data(), x.data()};
+            evaluate(prg, columns, rows);
+            for (size_t i = 0; i < rows; i++)
+                assert(y[i] == expected_y && x[i] == expected_x);
+        }
+    }
+    {
+        std::string input = "a\xff\xfe\x80" "b\xe0\x80\xaf\xed\xa0\x80\xe2\x82";
+        assert(
+            run_test(
+                input,
+                {
+                    {token::symbol_kind, input.data(), 1, 1, 1},
+                    {token::bad_char_kind, input.data() + 1, 1, 2, 1, token::bad_lead_byte},
+                    {token::bad_char_kind, input.data() + 2, 1, 3, 1, token::bad_lead_byte},
+                    {token::bad_char_kind, input.data() + 3, 1, 4, 1, token::bad_lead_byte},
+                    {token::symbol_kind, input.data() + 4, 1, 5, 1},
+                    {token::bad_char_kind, input.data() + 5, 3, 6, 1, token::overlong_encoding},
+                    {token::bad_char_kind, input.data() + 8, 3, 7, 1, token::surrogate_code_point},
+                    {token::bad_char_kind, input.data() + 11, 2, 8, 1, token::missing_trailing_bytes},
+                    {token::eol_kind, input.data() + input.length(), 1, 9, 1}
+                }
+            )
+        );
+
+        auto tokenizer = tokenizer::from_string(input);
+        tokenizer.coalesce_bad_bytes = true;
+        auto bad_run = (tokenizer.next_token(), tokenizer.next_token());
+        assert(bad_run.kind == token::bad_char_kind);
+        assert(bad_run.length == 3 && bad_run.column_length == 3);
+        assert(bad_run.error == token::bad_lead_byte);
+        assert(tokenizer.next_token().string_view() == "b");
+        bad_run = tokenizer.next_token();
+        assert(bad_run.length == input.length() - 5);
+        assert(bad_run.error == token::overlong_encoding);
+        assert(tokenizer.next_token().kind == token::eol_kind);
+
+        // Truncated sequence at the very end of an unterminated buffer
+        auto truncated = std::make_unique<char[]>(2);
+        truncated[0] = '\xf0';
+        truncated[1] = '\x9f';
+        ::tokenizer exact = {truncated.get(), truncated.get() + 2, 1, 1};
+        auto bad = exact.next_token();
+        assert(bad.kind == token::bad_char_kind && bad.length == 2);
+        assert(bad.error == token::missing_trailing_bytes);
+    }
+    {
+        // Sentinel scanning gives the same tokens as checking the end per byte
+        std::string inputs[] = {
+            "x1 = 2.5*(µ7 + y)", "12.", "abc", "a\xe2\x82", std::string("ab\0cd 1", 7)
+        };
+        for (const auto &input : inputs) {
+            auto buffer = padded_buffer::from_string(input);
+            auto padded = tokenizer::from_buffer(buffer);
+            ::tokenizer unpadded = {input.data(), input.data() + input.length(), 1, 1};
+            assert(padded.padding == padded_buffer::padding && unpadded.padding == 0);
+            while (true) {
+                auto expected = unpadded.next_token();
+                auto next_token = padded.next_token();
+                assert(next_token.kind == expected.kind);
+                assert(next_token.position - buffer.data() == expected.position - input.data());
+                assert(next_token.length == expected.length);
+                assert(next_token.column == expected.column);
+                if (expected.kind == token::eol_kind)
+                    break;
+            }
+        }
+    }
+    {
+        // The table decoder agrees with a byte by byte decoder, whether the
+        // sequence is loaded as one word or read up to the end
+        auto reference = [](std::string_view bytes, uint32_t &code, size_t &length, token::error_type &error) {
+            uint8_t lead = bytes[0];
+            size_t expected_length = lead >= 0xc0 && lead < 0xe0 ? 2 : lead >= 0xe0 && lead < 0xf0 ? 3 : lead >= 0xf0 && lead < 0xf8 ? 4 : 0;
+            if (expected_length == 0) {
+                length = 1;
+                error = token::bad_lead_byte;
+                return false;
+            }
+            code = lead & (0x7f >> expected_length);
+            for (length = 1; length < expected_length; length++) {
+                if (length == bytes.size()) {
+                    error = token::missing_trailing_bytes;
+                    return false;
+                }
+                if ((uint8_t(bytes[length]) & 0xc0) != 0x80) {
+                    error = token::bad_trailing_byte;
+                    return false;
+                }
+                code = (code << 6) | (bytes[length] & 0x3f);
+            }
+            uint32_t min_code[] = {0, 0, 0x80, 0x800, 0x10000};
+            error = code < min_code[length] ? token::overlong_encoding
+                : code >= 0xd800 && code <= 0xdfff ? token::surrogate_code_point
+                : code > 0x10ffff ? token::code_point_too_large
+                : token::no_error;
+            return error == token::no_error;
+        };
+
+        const uint8_t trailing[] = {0x00, 0x41, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf, 0xc0, 0xff};
+        for (unsigned lead = 0x80; lead <= 0xff; lead++)
+        for (uint8_t b1 : trailing)
+        for (uint8_t b2 : trailing)
+        for (uint8_t b3 : trailing)
+        for (size_t size = 1; size <= 4; size++) {
+            char bytes[] = {char(lead), char(b1), char(b2), char(b3)};
+            std::string_view input(bytes, size);
+            uint32_t expected_code = 0;
+            size_t expected_length = 0;
+            auto expected_error = token::no_error;
+            bool expected_valid = reference(input, expected_code, expected_length, expected_error);
+
+            auto buffer = padded_buffer::from_string(input);
+            ::tokenizer unpadded = {bytes, bytes + size, 1, 1};
+            for (auto scanner : {tokenizer::from_buffer(buffer), unpadded}) {
+                uint32_t code = 0;
+                bool valid = scanner.decode_utf8(code);
+                assert(valid == expected_valid);
+                assert(scanner.current_char_length == expected_length);
+                assert(valid ? code == expected_code : scanner.current_char_error == expected_error);
+            }
+        }
+    }
+#ifdef TOKENIZER_STATS
+    {
+        std::string input = "ab µx 12 \xff";
+        auto before = stats_snapshot();
+        tokenize(input, [](const token &) {});
+        auto after = stats_snapshot();
+        auto delta = [&](size_t counter) { return after[counter] - before[counter]; };
+        assert(delta(stat_bytes_scanned) == input.length());
+        assert(delta(stat_tokens + size_t(token::symbol_kind)) == 2);
+        assert(delta(stat_tokens + size_t(token::number_kind)) == 1);
+        assert(delta(stat_tokens + size_t(token::bad_char_kind)) == 1);
+        assert(delta(stat_tokens + size_t(token::eol_kind)) == 1);
+        assert(delta(stat_ascii_fast_path) == 5);
+        assert(delta(stat_utf8_slow_path) == 2);
+        assert(delta(stat_table_lookups) == 1);
+        assert(delta(stat_bad_chars) == 1);
+        assert(delta(stat_utf8_errors) == 1);
+
+        // Batches count each byte once, on either path
+        std::vector<std::string_view> lines = {"ascii = 1", input, ""};
+        token_batch batch;
+        before = stats_snapshot();
+        batch.tokenize(lines);
+        after = stats_snapshot();
+        assert(delta(stat_bytes_scanned) == lines[0].length() + lines[1].length());
+    }
+    {
+        // After the first letter of each table, a one-script identifier is
+        // matched from the remembered range
+        std::string input = "переменная∑ µµ";
+        std::vector<std::string> spellings;
+        auto before = stats_snapshot();
+        tokenize(input, [&](const token &next_token) {
+            spellings.emplace_back(next_token.string_view());
+        });
+        auto after = stats_snapshot();
+        auto delta = [&](size_t counter) { return after[counter] - before[counter]; };
+        assert(spellings.size() == 4 && spellings[0] == "переменная" && spellings[1] == "∑" && spellings[2] == "µµ");
+        // п and е miss; ∑ is looked up in both tables; µ misses each memo
+        assert(delta(stat_table_memo_hits) == 8);
+        assert(delta(stat_table_lookups) == 6);
+    }
+#endif
+    {
+        for (uint64_t value : {0ull, 31ull, 32ull, 33ull, 1000ull, 123456789ull, ~0ull}) {
+            size_t index = latency_histogram::bucket_index(value);
+            assert(index < latency_histogram::bucket_count);
+            assert(latency_histogram::bucket_value(index) <= value);
+            if (index + 1 < latency_histogram::bucket_count)
+                assert(latency_histogram::bucket_value(index + 1) > value);
+        }
+
+        latency_histogram histogram;
+        for (uint64_t value = 1; value <= 10000; value++)
+            histogram.record(value);
+        auto p50 = histogram.percentile(0.5);
+        auto p99 = histogram.percentile(0.99);
+        assert(p50 >= 5000 && p50 <= 5000 + 5000 / 16);
+        assert(p99 >= 9900 && p99 <= 10000);
+        assert(histogram.percentile(1.0) == 10000);
+
+        slowest_inputs<2> slowest;
+        slowest.record(5, "a");
+        slowest.record(7, "b");
+        slowest.record(6, "c");
+        std::ostringstream str;
+        str << slowest;
+        assert(str.str().find("'b'") < str.str().find("'c'"));
+        assert(str.str().find("'a'") == std::string::npos);
+    }
+    {
+        spsc_ring<int, 4> ring;
+        int value = 0;
+        assert(!ring.try_pop(value));
+        for (int i = 0; i < 4; i++) {
+            value = i;
+            assert(ring.try_push(value));
+        }
+        value = 4;
+        assert(!ring.try_push(value));
+        for (int i = 0; i < 6; i++) {
+            ring.pop(value);
+            assert(value == i);
+            value = i + 4;
+            ring.push(value);
+        }
+
+        std::string input;
+        for (int i = 0; i < 500; i++)
+            input += "x" + std::to_string(i) + " = (a + " + std::to_string(i) + ".5) * µ\n";
+        input += "last line without newline";
+
+        std::ostringstream expected;
+        print_line_tokens(expected, input + "\n");
+
+        for (size_t workers : {1, 3}) {
+            std::FILE* in = std::tmpfile();
+            std::FILE* out = std::tmpfile();
+            std::fwrite(input.data(), 1, input.size(), in);
+            std::rewind(in);
+            pipeline{in, out, 100}.run(workers);
+
+            std::string output(std::ftell(out), '\0');
+            std::rewind(out);
+            assert(std::fread(&output[0], 1, output.size(), out) == output.size());
+            assert(output == expected.str());
+            std::fclose(in);
+            std::fclose(out);
+        }
+    }
+    {
+        std::vector<std::string> paths, contents;
+        for (size_t size : {size_t(0), size_t(10), 3 * file_reader::buffer_size + 7}) {
+            char path[] = "/tmp/tokenizer_test_XXXXXX";
+            int fd = mkstemp(path);
+            assert(fd >= 0);
+            std::string text;
+            for (size_t i = 0; i < size; i++)
+                text += (i % 17 == 16) ? '\n' : char('a' + i % 26);
+            assert(write(fd, text.data(), text.size()) == ssize_t(text.size()));
+            close(fd);
+            paths.push_back(path);
+            contents.push_back(text.empty() || text.back() == '\n' ? text : text + "\n");
+        }
+        paths.push_back("/tmp/tokenizer_test_missing/file");
+
+        for (auto backend : {file_reader::io_uring_backend, file_reader::thread_pool_backend}) {
+            std::vector<bool> seen(paths.size());
+            file_reader reader;
+            reader.backend = backend;
+            reader.read(paths, [&](size_t index, std::string_view text, int error) {
+                assert(!seen[index]);
+                seen[index] = true;
+                if (index == 3) {
+                    assert(error == ENOENT && text.empty());
+                    return;
+                }
+                assert(error == 0);
+                assert(text == contents[index]);
+            });
+            for (bool file_seen : seen)
+                assert(file_seen);
+        }
+
+        for (size_t i = 0; i < 3; i++)
+            unlink(paths[i].c_str());
+
+        // Pipes: short reads before the end, and no seeking
+        std::string large;
+        for (size_t i = 0; large.size() < 2 * file_reader::buffer_size; i++)
+            large += "x" + std::to_string(i) + " = " + std::to_string(i) + "\n";
+        for (auto backend : {file_reader::io_uring_backend, file_reader::thread_pool_backend}) {
+            for (const std::string &text : {std::string("a b\nc d"), large}) {
+                int ends[2];
+                assert(pipe(ends) == 0);
+                std::thread writer([&]() {
+                    size_t half = text.size() / 2;
+                    assert(write(ends[1], text.data(), half) == ssize_t(half));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    assert(write(ends[1], text.data() + half, text.size() - half) == ssize_t(text.size() - half));
+                    close(ends[1]);
+                });
+                file_reader reader;
+                reader.backend = backend;
+                size_t calls = 0;
+                reader.read({"/dev/fd/" + std::to_string(ends[0])}, [&](size_t, std::string_view contents, int error) {
+                    assert(error == 0);
+                    assert(contents == (text.back() == '\n' ? text : text + "\n"));
+                    calls++;
+                });
+                assert(calls == 1);
+                writer.join();
+                close(ends[0]);
+            }
+        }
+    }
+    {
+        std::string input;
+        for (int i = 0; i < 20000; i++)
+            input += "y" + std::to_string(i) + " = " + std::to_string(i) + " * x\n";
+
+        std::ostringstream expected;
+        print_line_tokens(expected, input);
+
+        std::vector<std::string> encodings = {input};
+#ifdef TOKENIZER_WITH_ZLIB
+        {
+            // Two gzip members, concatenated like `cat a.gz b.gz`
+            std::string gzip;
+            for (size_t half = 0; half < 2; half++) {
+                z_stream zlib = {};
+                assert(deflateInit2(&zlib, 6, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+                size_t begin = half * (input.size() / 2);
+                size_t end = half ? input.size() : input.size() / 2;
+                std::string member(deflateBound(&zlib, end - begin), '\0');
+                zlib.next_in = reinterpret_cast<Bytef*>(&input[begin]);
+                zlib.avail_in = uInt(end - begin);
+                zlib.next_out = reinterpret_cast<Bytef*>(&member[0]);
+                zlib.avail_out = uInt(member.size());
+                assert(deflate(&zlib, Z_FINISH) == Z_STREAM_END);
+                member.resize(zlib.total_out);
+                deflateEnd(&zlib);
+                gzip += member;
+            }
+            encodings.push_back(gzip);
+        }
+#endif
+        for (const auto &encoded : encodings) {
+            std::FILE* in = std::tmpfile();
+            std::FILE* out = std::tmpfile();
+            std::fwrite(encoded.data(), 1, encoded.size(), in);
+            std::rewind(in);
+            pipeline lines = {in, out, 4096};
+            lines.run(2);
+            assert(lines.error == nullptr);
+
+            std::string output(std::ftell(out), '\0');
+            std::rewind(out);
+            assert(std::fread(&output[0], 1, output.size(), out) == output.size());
+            assert(output == expected.str());
+            std::fclose(in);
+            std::fclose(out);
+        }
+
+        // Input that cannot be decompressed is an error, not text
+        std::vector<std::string> unsupported = {"\x28\xb5\x2f\xfd\x00"};
+#ifndef TOKENIZER_WITH_ZLIB
+        unsupported.push_back("\x1f\x8b\x08");
+#endif
+        for (const auto &encoded : unsupported) {
+            std::FILE* in = std::tmpfile();
+            std::fwrite(encoded.data(), 1, encoded.size(), in);
+            std::rewind(in);
+            input_stream stream(in);
+            char buffer[16];
+            assert(stream.read(buffer, sizeof(buffer)) == 0);
+            assert(stream.error != nullptr);
+            std::fclose(in);
+        }
+    }
+    {
+        // Every kernel level agrees with the scalar kernels, at every offset
+        std::string bytes;
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < 4096; i++) {
+            seed = seed * 1103515245 + 12345;
+            size_t pick = (seed >> 16) % 100;
+            // Mostly long runs of one class, so the vector loops are exercised
+            if (pick < 40)
+                bytes += "abcXYZ_019"[seed % 10];
+            else if (pick < 60)
+                bytes += char(0x80 + (seed >> 8) % 0x42);
+            else if (pick < 75)
+                bytes += char(0xf5 + (seed >> 8) % 11);
+            else
+                bytes += char(seed >> 8);
+        }
+        for (auto level : {"scalar", "sse42", "avx2", "avx512"}) {
+            const auto &kernels = select_kernels(level);
+            for (size_t offset = 0; offset < bytes.size(); offset += 7) {
+                const char* p = bytes.data() + offset;
+                size_t n = bytes.size() - offset;
+                assert(kernels.identifier_run(p, n) == scalar_kernels.identifier_run(p, n));
+                assert(kernels.non_lead_run(p, n) == scalar_kernels.non_lead_run(p, n));
+            }
+        }
+
+        std::string input = "a_very_long_identifier_name_1234µ_and_more = 2";
+        auto tokenizer = tokenizer::from_string(input);
+        auto identifier = tokenizer.next_token();
+        assert(identifier.length == input.find(' '));
+        assert(identifier.column_length == identifier.length - 1);
+        assert(tokenizer.next_token().column == identifier.column_length + 2);
+    }
+    {
+        // UTF16 and UTF32 input is scanned in place, positions count code units
+        std::u16string wide = u"x1 = \U0001d465\u00b5 + 2";
+        std::vector<basic_token<char16_t>> tokens;
+        tokenize(wide, [&](const basic_token<char16_t> &next_token) {
+            tokens.push_back(next_token);
+        });
+        assert(tokens.size() == 6);
+        assert(tokens[2].kind == basic_token<char16_t>::symbol_kind);
+        assert(tokens[2].position == wide.data() + 5 && tokens[2].length == 3);
+        assert(tokens[2].column == 6 && tokens[2].column_length == 2);
+        assert(tokens[4].kind == basic_token<char16_t>::number_kind && tokens[4].column == 11);
+        std::ostringstream printed;
+        printed << tokens[2];
+        assert(printed.str() == "SYM @ col:6, len:2 :: '\U0001d465\u00b5'");
+
+        std::u16string unpaired = {u'a', char16_t(0xd800), u'b', char16_t(0xdc00)};
+        auto utf16 = basic_tokenizer<char16_t>::from_string(unpaired);
+        assert(utf16.next_token().length == 1);
+        auto bad = utf16.next_token();
+        assert(bad.kind == basic_token<char16_t>::bad_char_kind);
+        assert(bad.error == basic_token<char16_t>::unpaired_surrogate);
+        assert(utf16.next_token().length == 1);
+        assert(utf16.next_token().error == basic_token<char16_t>::unpaired_surrogate);
+        assert(utf16.next_token().kind == basic_token<char16_t>::eol_kind);
+
+        std::u32string utf32_input = {U'\u00e9', U'1', U' ', char32_t(0x110000), char32_t(0xdfff)};
+        token_stream<4, char32_t> utf32(basic_tokenizer<char32_t>::from_string(utf32_input));
+        assert(utf32.peek().length == 2 && utf32.peek().column_length == 2);
+        utf32.next();
+        assert(utf32.next().error == basic_token<char32_t>::code_point_too_large);
+        assert(utf32.next().error == basic_token<char32_t>::surrogate_code_point);
+        assert(utf32.next().kind == basic_token<char32_t>::eol_kind);
+    }
+    {
+        // Split input gives the same tokens as flat input, wherever it is split
+        std::string inputs[] = {
+            "x1 = 2.5*(\u00b57 + y)", "ab\u00b5\u20ac 12.75", "a\xe2\x82 \xff\xfe\xfd\xfc\xfb z", "\U0001d465\U0001d465", ""
+        };
+        for (const auto &input : inputs) {
+            for (bool coalesce : {false, true}) {
+                for (size_t i = 0; i <= input.size(); i++) {
+                    for (size_t j = i; j <= input.size(); j++) {
+                        std::string_view text = input;
+                        std::vector<std::string_view> pieces = {
+                            text.substr(0, i), text.substr(i, j - i), text.substr(j)
+                        };
+                        auto segmented = segmented_tokenizer::from_pieces(pieces);
+                        auto flat = tokenizer::from_string(input);
+                        segmented.coalesce_bad_bytes = flat.coalesce_bad_bytes = coalesce;
+                        while (true) {
+                            auto expected = flat.next_token();
+                            auto next_token = segmented.next_token();
+                            assert(next_token.kind == expected.kind);
+                            assert(segmented.offset == size_t(expected.position - input.data()));
+                            assert(next_token.column == expected.column);
+                            assert(next_token.column_length == expected.column_length);
+                            assert(next_token.error == expected.error);
+                            if (expected.kind == token::eol_kind)
+                                break;
+                            assert(next_token.string_view() == expected.string_view());
+                        }
+                    }
+                }
+            }
+        }
+
+        std::string long_identifier(1000, 'q');
+        std::vector<std::string_view> pieces;
+        for (size_t i = 0; i < long_identifier.size(); i += 10)
+            pieces.push_back(std::string_view(long_identifier).substr(i, 10));
+        auto segmented = segmented_tokenizer::from_pieces(pieces);
+        assert(segmented.next_token().length == 1000);
+        assert(segmented.next_token().kind == token::eol_kind);
+    }
+    {
+        // Batched lines give the same tokens as lines tokenized one by one
+        std::vector<std::string> inputs = {
+            "x1 = 2.5*(y7 + y)", "", "  12. .5 1.2.3 a.5 ", "12ab_3\t#?", "\u00b5 = 1", "a\xe2\x82",
+            std::string(70, 'q') + " + " + std::string(70, '9')
+        };
+        uint32_t seed = 7;
+        for (size_t i = 0; i < 200; i++) {
+            std::string line;
+            size_t length = (seed = seed * 1103515245 + 12345) >> 16 & 63;
+            for (size_t k = 0; k < length; k++)
+                line += " \tab_Z09.()+-*/=#\x01"[(seed = seed * 1103515245 + 12345) >> 16 & 15];
+            inputs.push_back(line);
+        }
+        std::vector<std::string_view> lines(inputs.begin(), inputs.end());
+
+        for (auto level : {"scalar", "sse42", "avx2", "avx512"}) {
+            const auto &kernels = select_kernels(level);
+            block_classes expected = {}, classes = {};
+            std::string block = inputs[2] + inputs[4] + inputs[3] + inputs[0] + "\x80\xff" + inputs[6];
+            scalar_kernels.classify_block(block.data(), expected);
+            kernels.classify_block(block.data(), classes);
+            assert(classes.space == expected.space && classes.identifier == expected.identifier);
+            assert(classes.digit == expected.digit && classes.non_ascii == expected.non_ascii);
+        }
+
+        token_batch batch;
+        for (size_t round = 0; round < 2; round++) {
+            batch.tokenize(lines);
+            assert(batch.line_count() == lines.size());
+            for (size_t i = 0; i < lines.size(); i++) {
+                std::vector<token> expected;
+                tokenize(inputs[i], [&](const token &next_token) {
+                    expected.push_back(next_token);
+                });
+                auto line = batch.line(i);
+                assert(line.size() == expected.size());
+                for (size_t k = 0; k < expected.size(); k++) {
+                    const token &next_token = line.begin()[k];
+                    assert(next_token.kind == expected[k].kind);
+                    assert(next_token.position - lines[i].data() == expected[k].position - inputs[i].data());
+                    assert(next_token.length == expected[k].length);
+                    assert(next_token.column == expected[k].column);
+                    assert(next_token.column_length == expected[k].column_length);
+                    assert(next_token.error == expected[k].error);
+                }
+            }
+            lines.resize(3);
+            inputs.resize(3);
+        }
+    }
+    {
+        // Heavy hitters: exact while everything fits, bounded after merging
+        identifier_frequencies exact(8);
+        exact.add_lines("a = b * a\nc + a(b)\n");
+        auto report = exact.report();
+        assert(report.size() == 3 && report[0].identifier == "a" && report[0].lower == 3 && report[0].upper == 3);
+        assert(report[1].identifier == "b" && report[1].lower == 2);
+
+        // Zipf-like: identifier i occurs about 2000 / i times, split over two
+        // workers that each see every identifier
+        identifier_frequencies halves[] = {identifier_frequencies(16, 256), identifier_frequencies(16, 256)};
+        std::vector<uint64_t> counts(400);
+        for (size_t i = 1; i < counts.size(); i++) {
+            counts[i] = 2000 / i;
+            for (uint64_t k = 0; k < counts[i]; k++)
+                halves[k % 2].add("id" + std::to_string(i));
+        }
+        halves[0].merge(halves[1]);
+        report = halves[0].report();
+        assert(report.size() == 16);
+        for (const auto &hitter : report) {
+            uint64_t count = counts[std::stoul(hitter.identifier.substr(2))];
+            assert(hitter.lower <= count && count <= hitter.upper);
+        }
+        // Guaranteed kept: more frequent than total / k
+        assert(report[0].identifier == "id1" && report[1].identifier == "id2");
+        assert(halves[0].sketch.estimate(hash_bytes("id3")) >= counts[3]);
+        assert(halves[0].sketch.estimate(hash_bytes("id3")) <= counts[3] + halves[0].sketch.error_bound());
+    }
+    {
+        // Myers diff finds a shortest edit script, checked against LCS lengths
+        uint32_t seed = 11;
+        auto random = [&](size_t bound) {
+            seed = seed * 1103515245 + 12345;
+            return (seed >> 16) % bound;
+        };
+        for (size_t round = 0; round < 300; round++) {
+            std::vector<uint64_t> a(random(30)), b(random(30));
+            for (auto &key : a)
+                key = random(4);
+            for (auto &key : b)
+                key = random(4);
+            myers_diff script(a, b);
+
+            std::vector<std::vector<size_t>> lcs(a.size() + 1, std::vector<size_t>(b.size() + 1));
+            for (size_t i = a.size(); i-- > 0;)
+                for (size_t j = b.size(); j-- > 0;)
+                    lcs[i][j] = a[i] == b[j] ? lcs[i + 1][j + 1] + 1 : std::max(lcs[i + 1][j], lcs[i][j + 1]);
+            std::vector<uint64_t> kept_a, kept_b;
+            for (size_t i = 0; i < a.size(); i++)
+                if (!script.deleted[i])
+                    kept_a.push_back(a[i]);
+            for (size_t j = 0; j < b.size(); j++)
+                if (!script.inserted[j])
+                    kept_b.push_back(b[j]);
+            assert(kept_a == kept_b && kept_a.size() == lcs[0][0]);
+        }
+
+        auto old_tokens = diff_tokens("x = f(a) + 1\ny = 2\nz = 3\n");
+        auto new_tokens = diff_tokens("z   =   3\nx = f(a)\n  + 2\ny = 2\n");
+        auto diff = token_diff::of(old_tokens, new_tokens);
+        std::ostringstream printed;
+        print_diff(printed, old_tokens, new_tokens, diff);
+        assert(printed.str() ==
+            "- 1:12 1\n"
+            "+ 3:5 2\n"
+            "> 3:1 -> 1:1 z = 3\n");
+        assert(token_diff::of(old_tokens, diff_tokens("x=f( a )+1 y=2\n\nz=3\n")).hunks.empty());
+    }
+    {
+        // Token patterns match regardless of spacing, and may overlap
+        auto pattern = token_pattern::compile("SYM = NUM *");
+        assert(pattern.error == nullptr && pattern.length == 4);
+        std::ostringstream printed;
+        print_pattern_matches(printed, pattern, "x=2*y\ny = 2\n  a  =  1.5 * b = 3 * c\n", 7);
+        assert(printed.str() ==
+            "7:1: x=2*y\n"
+            "9:3:   a  =  1.5 * b = 3 * c\n"
+            "9:15:   a  =  1.5 * b = 3 * c\n");
+
+        auto call = token_pattern::compile("f( ANY ) 'SYM'");
+        assert(call.error == nullptr && call.length == 5);
+        printed.str("");
+        print_pattern_matches(printed, call, "f(f(x) SYM) f (\xff) SYM\n", 1);
+        assert(printed.str() ==
+            "1:3: f(f(x) SYM) f (\xff) SYM\n"
+            "1:13: f(f(x) SYM) f (\xff) SYM\n");
+
+        assert(token_pattern::compile("  ").error != nullptr);
+        assert(token_pattern::compile("'x").error != nullptr);
+        std::string too_long;
+        for (size_t i = 0; i <= token_pattern::max_length; i++)
+            too_long += "ANY ";
+        assert(token_pattern::compile(too_long).error != nullptr);
+    }
+    {
+        // Scanning resumed from any index entry continues the full scan exactly
+        std::string text;
+        for (size_t i = 0; i < 50; i++)
+            text += "x" + std::to_string(i) + " = (a + 2.5) * \u00b5" + std::string(i % 7, ' ') + "\n" + (i % 5 == 0 ? "\n" : "");
+        std::vector<token> all;
+        std::vector<uint64_t> lines;
+        for (auto scanner = text_scanner::from_text(text); !scanner.at_end();) {
+            lines.push_back(scanner.line);
+            all.push_back(scanner.next_token());
+        }
+
+        for (auto intervals : {std::pair<uint64_t, uint64_t>(64, 0), std::pair<uint64_t, uint64_t>(0, 3), std::pair<uint64_t, uint64_t>(100, 7)}) {
+            token_index index;
+            index.byte_interval = intervals.first;
+            index.line_interval = intervals.second;
+            for (auto scanner = text_scanner::from_text(text, &index); !scanner.at_end();)
+                scanner.next_token();
+            assert(index.entries.size() > 5 && index.entries[0].offset == 0);
+
+            std::FILE* file = std::tmpfile();
+            assert(index.save(file));
+            std::rewind(file);
+            token_index loaded;
+            assert(loaded.load(file) == nullptr);
+            std::fclose(file);
+            assert(loaded.entries.size() == index.entries.size() && loaded.text_size == text.size());
+
+            for (const auto &entry : loaded.entries) {
+                auto resumed = text_scanner::resume(text, loaded, entry);
+                assert(resumed);
+                auto &scanner = *resumed;
+                for (uint64_t ordinal = entry.ordinal; ordinal < all.size(); ordinal++) {
+                    assert(scanner.line == lines[ordinal]);
+                    auto next_token = scanner.next_token();
+                    assert(next_token.kind == all[ordinal].kind && next_token.position == all[ordinal].position);
+                    assert(next_token.column == all[ordinal].column && next_token.length == all[ordinal].length);
+                }
+                assert(scanner.at_end());
+            }
+            assert(loaded.nearest_offset(text.size() / 2).offset <= text.size() / 2);
+            assert(loaded.nearest_line(30).line <= 30);
+            if (intervals.second != 0)
+                assert(loaded.nearest_line(30).line > 30 - intervals.second);
+
+            // Another text cannot be scanned with the index
+            assert(!text_scanner::resume(text.substr(0, text.size() / 2), loaded, loaded.entries[1]));
+        }
+
+        // An empty text still has the entry at its start
+        token_index empty;
+        empty.byte_interval = 64;
+        assert(text_scanner::from_text("", &empty).at_end());
+        assert(empty.entries.size() == 1 && empty.nearest_offset(0).offset == 0 && empty.nearest_line(5).line == 1);
+
+        std::FILE* file = std::tmpfile();
+        std::fputs("nope", file);
+        std::rewind(file);
+        token_index bad;
+        assert(bad.load(file) != nullptr);
+        std::fclose(file);
+
+        // Corrupt files are reported, not trusted
+        auto load_changed = [](token_index changed, uint64_t count) {
+            std::FILE* file = std::tmpfile();
+            uint64_t header[] = {changed.byte_interval, changed.line_interval, changed.text_size, count};
+            std::fwrite(token_index::magic, sizeof(token_index::magic), 1, file);
+            std::fwrite(&token_index::version, sizeof(token_index::version), 1, file);
+            std::fwrite(header, sizeof(header), 1, file);
+            if (!changed.entries.empty())
+                std::fwrite(changed.entries.data(), sizeof(token_index::entry), changed.entries.size(), file);
+            std::rewind(file);
+            token_index loaded;
+            const char* error = loaded.load(file);
+            std::fclose(file);
+            return error == nullptr ? std::string() : std::string(error);
+        };
+        token_index good;
+        good.text_size = 100;
+        good.entries = {{0, 0, 1, 1}, {50, 10, 3, 4}, {90, 20, 5, 1}};
+        assert(load_changed(good, 3).empty());
+        assert(load_changed(good, 4) == "truncated token index");
+        assert(load_changed(good, uint64_t(1) << 60) == "truncated token index");
+        token_index past_end = good;
+        past_end.entries[2].offset = 101;
+        assert(load_changed(past_end, 3) == "corrupt token index");
+        token_index unsorted = good;
+        std::swap(unsorted.entries[1], unsorted.entries[2]);
+        assert(load_changed(unsorted, 3) == "corrupt token index");
+        token_index no_entries = good;
+        no_entries.entries.clear();
+        assert(load_changed(no_entries, 0) == "corrupt token index");
+        token_index late_start = good;
+        late_start.entries[0] = {50, 0, 1, 1};
+        assert(load_changed(late_start, 3) == "corrupt token index");
+        token_index same_offset = good;
+        same_offset.entries[2] = {50, 20, 5, 1};
+        assert(load_changed(same_offset, 3) == "corrupt token index");
+
+        // A pipe cannot be measured; a huge count fails when the data runs out
+        int ends[2];
+        assert(pipe(ends) == 0);
+        std::FILE* writer = fdopen(ends[1], "w");
+        uint64_t header[] = {0, 0, 100, uint64_t(1) << 60};
+        std::fwrite(token_index::magic, sizeof(token_index::magic), 1, writer);
+        std::fwrite(&token_index::version, sizeof(token_index::version), 1, writer);
+        std::fwrite(header, sizeof(header), 1, writer);
+        std::fwrite(good.entries.data(), sizeof(token_index::entry), good.entries.size(), writer);
+        std::fclose(writer);
+        std::FILE* reader = fdopen(ends[0], "r");
+        assert(std::string(bad.load(reader)) == "truncated token index");
+        std::fclose(reader);
+    }
+    {
+        // The daemon answers batched requests from several clients like the scanner would
+        std::string path = "/tmp/tokenizer_test_" + std::to_string(::getpid()) + ".sock";
+        token_server server;
+        assert(server.listen(path.c_str()) == nullptr);
+        std::thread serving([&]() { server.run(2); });
+
+        auto expected_tokens = [](std::string_view buffer) {
+            std::vector<wire_token> result;
+            std::string text(buffer);
+            if (!text.empty() && text.back() != '\n')
+                text += '\n';
+            for (size_t start = 0; start < text.size();) {
+                size_t end = text.find('\n', start);
+                auto scanner = tokenizer::from_line(std::string_view(text).substr(start, end - start));
+                tokenize(scanner, [&](const token &next_token) {
+                    result.push_back({uint32_t(next_token.position - text.data()), uint32_t(next_token.length),
+                                      uint32_t(next_token.column), uint8_t(next_token.kind), uint8_t(next_token.error), 0});
+                });
+                start = end + 1;
+            }
+            return result;
+        };
+        auto same = [](const std::vector<wire_token> &a, const std::vector<wire_token> &b) {
+            return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(wire_token)) == 0);
+        };
+
+        std::vector<std::thread> clients;
+        for (int c = 0; c < 3; c++) {
+            clients.emplace_back([&, c]() {
+                token_client client;
+                assert(client.connect(path.c_str()) == nullptr);
+                std::vector<std::vector<wire_token>> tokens;
+                for (int i = 0; i < 200; i++) {
+                    std::string first = "x" + std::to_string(c * 1000 + i) + " = (a + 2.5) * b\n\nc";
+                    std::vector<std::string_view> buffers = {first, "", "\xff\xfe \u00b5\n1.5\n"};
+                    bool answered = client.tokenize(buffers, tokens);
+                    assert(answered && tokens.size() == 3);
+                    for (size_t b = 0; b < buffers.size(); b++)
+                        assert(same(tokens[b], expected_tokens(buffers[b])));
+                }
+            });
+        }
+        for (auto &client : clients)
+            client.join();
+
+        // A malformed request ends the connection
+        token_client client;
+        assert(client.connect(path.c_str()) == nullptr);
+        std::string bad;
+        append_uint32(bad, 8);
+        append_uint32(bad, 1);
+        append_uint32(bad, 100);
+        assert(send_all(client.fd, bad));
+        uint32_t size;
+        assert(!receive_all(client.fd, reinterpret_cast<char*>(&size), sizeof(size)));
+
+        // A second daemon leaves a live socket to the first one
+        token_server second;
+        assert(std::string(second.listen(path.c_str())) == "another server is listening on the socket");
+
+        server.stop();
+        serving.join();
+
+        // Only a dead socket file is replaced, never other files
+        std::string other_path = path + ".txt";
+        std::FILE* other = std::fopen(other_path.c_str(), "w");
+        std::fputs("keep", other);
+        std::fclose(other);
+        token_server wrong_path;
+        assert(std::string(wrong_path.listen(other_path.c_str())) == "path exists and is not a socket");
+        struct stat status;
+        assert(::stat(other_path.c_str(), &status) == 0 && status.st_size == 4);
+        ::unlink(other_path.c_str());
+
+        std::string dead_path = path + ".dead";
+        int dead = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        std::strcpy(address.sun_path, dead_path.c_str());
+        assert(::bind(dead, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+        ::close(dead);
+        token_server restarted;
+        assert(restarted.listen(dead_path.c_str()) == nullptr);
+    }
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    {
+        // Literals tokenized by the compiler match the run-time scan
+        constexpr auto tokens = tokenize<"x = 2*µ (3.5)">();
+        static_assert(tokens.size() == 9);
+        static_assert(tokens[0].kind == token::symbol_kind && tokens[0].string_view() == "x");
+        static_assert(tokens[2].kind == token::number_kind && tokens[2].column == 5);
+        static_assert(tokens[4].kind == token::symbol_kind && tokens[4].string_view() == "µ" && tokens[4].column_length == 1);
+        static_assert(tokens[6].string_view() == "3.5" && tokens[6].column == 10);
+        static_assert(tokens[8].kind == token::eol_kind);
+
+        std::string text = "x = 2*µ (3.5)";
+        size_t i = 0;
+        tokenize(text, [&](const token &next_token) {
+            assert(next_token.kind == tokens[i].kind && next_token.string_view() == tokens[i].string_view());
+            assert(next_token.column == tokens[i].column);
+            i++;
+        });
+        assert(i == tokens.size());
+    }
+#endif
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    auto usage =
+        "Usage: tokenizer [--stats] [--latency] [--pipeline [--workers N]]\n"
+        "       tokenizer [--stats] --top K [--workers N]\n"
+        "       tokenizer [--stats] --grep PATTERN [--workers N]\n"
+        "       tokenizer [--stats] --files PATH...\n"
+        "       tokenizer --diff OLD NEW\n"
+        "       tokenizer --serve SOCKET [--workers N]";
+    bool print_stats = false;
+    bool measure_latency = false;
+    bool run_pipeline = false;
+    size_t top_count = 0;
+    const char* grep_pattern = nullptr;
+    std::vector<std::string> files;
+    const char* socket_path = nullptr;
+    size_t workers = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() - 2 : 1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--stats") {
+            print_stats = true;
+        }
+        else if (arg == "--latency") {
+            measure_latency = true;
+        }
+        else if (arg == "--pipeline") {
+            run_pipeline = true;
+        }
+        else if (arg == "--top" && i + 1 < argc) {
+            top_count = std::strtoul(argv[++i], nullptr, 10);
+            if (top_count == 0) {
+                std::cerr << usage << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (arg == "--grep" && i + 1 < argc) {
+            grep_pattern = argv[++i];
+        }
+        else if (arg == "--serve" && i + 1 < argc) {
+            socket_path = argv[++i];
+        }
+        else if (arg == "--workers" && i + 1 < argc) {
+            workers = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--diff" && i + 3 == argc) {
+            // Token-level diff of two files, ignoring whitespace
+            std::vector<std::string> paths = {argv[i + 1], argv[i + 2]};
+            std::string contents[2];
+            int status = EXIT_SUCCESS;
+            file_reader{}.read(paths, [&](size_t index, std::string_view text, int error) {
+                if (error != 0) {
+                    std::cerr << paths[index] << ": " << std::strerror(error) << std::endl;
+                    status = EXIT_FAILURE;
+                }
+                contents[index] = text;
+            });
+            if (status != EXIT_SUCCESS)
+                return status;
+            auto old_tokens = diff_tokens(contents[0]);
+            auto new_tokens = diff_tokens(contents[1]);
+            auto diff = token_diff::of(old_tokens, new_tokens);
+            print_diff(std::cout, old_tokens, new_tokens, diff);
+            std::cout << std::flush;
+            return diff.hunks.empty() ? EXIT_SUCCESS : 1;
+        }
+        else if (arg == "--files") {
+            files.assign(argv + i + 1, argv + argc);
+            if (files.empty()) {
+                std::cerr << usage << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        }
+        else {
+            std::cerr << "Unknown option '" << arg << "'" << std::endl;
+            std::cerr << usage << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (socket_path != nullptr) {
+        // Daemon: tokenizes requests from local clients until killed
+        token_server server;
+        if (auto error = server.listen(socket_path)) {
+            std::cerr << socket_path << ": " << error << std::endl;
+            return EXIT_FAILURE;
+        }
+        server.run(workers);
+        return EXIT_SUCCESS;
+    }
+
+    if (run_pipeline || top_count != 0 || grep_pattern != nullptr || !files.empty()) {
+        if (grep_pattern != nullptr) {
+            // Lines of stdin with a token sequence matching the pattern
+            auto pattern = token_pattern::compile(grep_pattern);
+            if (pattern.error != nullptr) {
+                std::cerr << "Bad pattern: " << pattern.error << std::endl;
+                return EXIT_FAILURE;
+            }
+            pipeline lines = {stdin, stdout};
+            lines.print = [&](std::ostream &str, std::string_view text, size_t first_line) {
+                print_pattern_matches(str, pattern, text, first_line);
+            };
+            lines.run(workers);
+            if (lines.error != nullptr) {
+                std::cerr << "Input error: " << lines.error << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (top_count != 0) {
+            // Most frequent identifiers in stdin, counted in fixed memory per worker
+            pipeline lines = {stdin, stdout};
+            std::vector<identifier_frequencies> frequencies(std::max<size_t>(workers, 1), identifier_frequencies(top_count));
+            lines.analyze = [&](size_t index, std::string_view text) {
+                frequencies[index].add_lines(text);
+            };
+            lines.run(workers);
+            if (lines.error != nullptr) {
+                std::cerr << "Input error: " << lines.error << std::endl;
+                return EXIT_FAILURE;
+            }
+            for (size_t i = 1; i < frequencies.size(); i++)
+                frequencies[0].merge(frequencies[i]);
+            std::cout << frequencies[0] << std::flush;
+        }
+        else if (run_pipeline) {
+            // Non-interactive: tokenize all of stdin, printing tokens in input order
+            pipeline lines = {stdin, stdout};
+            lines.run(workers);
+            if (lines.error != nullptr) {
+                std::cerr << "Input error: " << lines.error << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else {
+            // Files are printed in the order they finish reading
+            int status = EXIT_SUCCESS;
+            file_reader{}.read(files, [&](size_t index, std::string_view contents, int error) {
+                if (error != 0) {
+                    std::cerr << files[index] << ": " << std::strerror(error) << std::endl;
+                    status = EXIT_FAILURE;
+                    return;
+                }
+                std::cout << "==> " << files[index] << " <==\n";
+                print_line_tokens(std::cout, contents);
+            });
+            std::cout << std::flush;
+            if (status != EXIT_SUCCESS)
+                return status;
+        }
+        if (print_stats) {
+#ifdef TOKENIZER_STATS
+            std::cout << stats_snapshot();
+#else
+            std::cout << "Statistics are not compiled in, build with -DTOKENIZER_STATS" << std::endl;
+#endif
+        }
+        return EXIT_SUCCESS;
+    }
+
     auto short_welcome = "Welcome to the tokenizer.";
     auto long_welcome = 
         "Input a line of code, and the tokenizer will return the tokens. "
@@ -91,23 +1211,58 @@ int main() {
     std::cout << long_welcome << std::endl;
     std::cout << std::endl << prompt << std::flush;
 
+    latency_histogram line_latency, token_latency;
+    slowest_inputs<> slowest_lines;
+    std::vector<token> line_tokens;
+
     for ( // Infinite REPL loop
         std::string line;
         std::getline(std::cin, line);
         std::cout << prompt << std::flush
     ) {
+        if (!measure_latency) {
+            tokenize(line, [](const token &next_token) {
+                std::cout << next_token << std::endl;
+            });
+            continue;
+        }
+
+        // Tokens are printed after the line is done, so only lexing is timed.
+        line_tokens.clear();
+        auto line_start = latency_clock::now();
         auto tokenizer = tokenizer::from_string(line);
         while (true) {
+            auto token_start = latency_clock::now();
             auto next_token = tokenizer.next_token();
-            std::cout << next_token << std::endl;
-
-            if (next_token.kind != token::eol_kind)
+            token_latency.record(latency_clock::now() - token_start);
+            line_tokens.push_back(next_token);
+            if (next_token.kind == token::eol_kind)
                 break;
-        };
+        }
+        auto latency = latency_clock::now() - line_start;
+        line_latency.record(latency);
+        slowest_lines.record(latency, line);
+
+        for (const auto &next_token : line_tokens)
+            std::cout << next_token << std::endl;
     }
 
     std::cout << "Exiting REPL..." << std::endl;
 
+    if (print_stats) {
+#ifdef TOKENIZER_STATS
+        std::cout << stats_snapshot();
+#else
+        std::cout << "Statistics are not compiled in, build with -DTOKENIZER_STATS" << std::endl;
+#endif
+    }
+
+    if (measure_latency) {
+        std::cout << "line latency:  " << line_latency << std::endl;
+        std::cout << "token latency: " << token_latency << std::endl;
+        std::cout << "slowest lines:" << std::endl << slowest_lines;
+    }
+
     run_all_tests();
 
     return EXIT_SUCCESS;
@@ -1,13 +1,27 @@
+#pragma once
+
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cassert>
+#include <cstring>
+#include <memory>
 
+#include "compile_time.hpp"
+#include "probes.hpp"
+#include "simd.hpp"
+#include "stats.hpp"
 #include "unicode_tables.h"
 
-struct token {
-    enum {
+// A token over a buffer of CharT code units: UTF8 for char, UTF16 for
+// char16_t and UTF32 for char32_t (wchar_t follows its size). Positions and
+// lengths count code units of the original buffer.
+template <typename CharT>
+struct basic_token {
+    enum kind_type {
         punctuation_kind,
         number_kind,
         symbol_kind,
@@ -15,19 +29,99 @@ struct token {
         bad_char_kind
     } kind = bad_char_kind;
 
-    const char* position = nullptr;
+    // One bit per kind, used to select which tokens a scan should produce.
+    using kind_mask = uint32_t;
+    static constexpr kind_mask mask_of(kind_type kind) {
+        return kind_mask(1) << kind;
+    }
+    static constexpr kind_mask all_kinds_mask = (kind_mask(1) << (bad_char_kind + 1)) - 1;
+
+    const CharT* position = nullptr;
     size_t length = 0;
 
     // Optimization(sorgre): Column data can be determined when printing.
     size_t column = 0;
     size_t column_length = 0;
 
-    std::string_view string_view() const {
-        return std::string_view(position, length);
+    // Why a bad_char_kind token is bad. A valid code point that cannot start
+    // or continue an identifier has no error.
+    enum error_type : uint8_t {
+        no_error,
+        bad_lead_byte,
+        missing_trailing_bytes,
+        bad_trailing_byte,
+        overlong_encoding,
+        surrogate_code_point,
+        code_point_too_large,
+        unpaired_surrogate
+    } error = no_error;
+
+    constexpr std::basic_string_view<CharT> string_view() const {
+        return std::basic_string_view<CharT>(position, length);
+    }
+
+    friend const char* error_message(error_type error) {
+        switch (error) {
+            case no_error:               return "no error";
+            case bad_lead_byte:          return "bad UTF8 lead byte";
+            case missing_trailing_bytes: return "missing UTF8 trailing bytes";
+            case bad_trailing_byte:      return "bad UTF8 trailing byte";
+            case overlong_encoding:      return "overlong UTF8 encoding";
+            case surrogate_code_point:   return "encoded surrogate";
+            case code_point_too_large:   return "code point too large";
+            case unpaired_surrogate:     return "unpaired UTF16 surrogate";
+        }
+        return "unknown error";
     }
 };
 
-std::ostream& operator << (std::ostream& str, const token &tkn) {
+using token = basic_token<char>;
+
+// Appends the UTF8 encoding of `code`.
+void append_utf8(std::string &out, uint32_t code) {
+    if (code < 0x80) {
+        out += char(code);
+    }
+    else if (code < 0x800) {
+        out += char(0xc0 | (code >> 6));
+        out += char(0x80 | (code & 0x3f));
+    }
+    else if (code < 0x10000) {
+        out += char(0xe0 | (code >> 12));
+        out += char(0x80 | ((code >> 6) & 0x3f));
+        out += char(0x80 | (code & 0x3f));
+    }
+    else {
+        out += char(0xf0 | (code >> 18));
+        out += char(0x80 | ((code >> 12) & 0x3f));
+        out += char(0x80 | ((code >> 6) & 0x3f));
+        out += char(0x80 | (code & 0x3f));
+    }
+}
+
+// UTF8 copy of UTF16 or UTF32 text, for printing. Code units that do not
+// form a valid code point come out as U+FFFD.
+template <typename CharT>
+std::string to_utf8(std::basic_string_view<CharT> text) {
+    std::string out;
+    for (size_t i = 0; i < text.length(); i++) {
+        uint32_t code = uint32_t(text[i]);
+        if (sizeof(CharT) == 2 && code >= 0xd800 && code <= 0xdbff && i + 1 < text.length() &&
+            uint32_t(text[i + 1]) >= 0xdc00 && uint32_t(text[i + 1]) <= 0xdfff) {
+            code = 0x10000 + ((code - 0xd800) << 10) + (uint32_t(text[i + 1]) - 0xdc00);
+            i++;
+        }
+        else if ((code >= 0xd800 && code <= 0xdfff) || code > 0x10ffff) {
+            code = 0xfffd;
+        }
+        append_utf8(out, code);
+    }
+    return out;
+}
+
+template <typename CharT>
+std::ostream& operator << (std::ostream& str, const basic_token<CharT> &tkn) {
+    using token = basic_token<CharT>;
     assert(tkn.position != nullptr);
     assert(tkn.length != 0);
     assert(tkn.column != 0);
@@ -43,131 +137,417 @@ std::ostream& operator << (std::ostream& str, const token &tkn) {
     str << " @ col:" << tkn.column;
     if (tkn.column_length > 1)
         str << ", len:" << tkn.column_length;
-    str << " :: '" << tkn.string_view() << "'";
+    // The end of line token points just past the buffer, so it has no spelling.
+    str << " :: '";
+    if (tkn.kind != token::eol_kind) {
+        if constexpr (sizeof(CharT) == 1)
+            str << std::string_view(reinterpret_cast<const char*>(tkn.position), tkn.length);
+        else
+            str << to_utf8(tkn.string_view());
+    }
+    str << "'";
+    if (tkn.error != token::no_error)
+        str << " (" << error_message(tkn.error) << ")";
 
     return str;
 }
 
-struct tokenizer {
-    const char* position = nullptr;
-    const char* const end = nullptr;
+// Owning copy of an input followed by `padding` zero bytes. Scanning can stop
+// on the zero sentinel instead of comparing against the end on every byte,
+// and vector loads of up to `padding` bytes may run past the end.
+struct padded_buffer {
+    static const size_t padding = 64;
+
+    std::unique_ptr<char[]> storage;
+    size_t length = 0;
+
+    static padded_buffer from_string(std::string_view str) {
+        padded_buffer buffer = {std::make_unique<char[]>(str.length() + padding), str.length()};
+        std::memcpy(buffer.storage.get(), str.data(), str.length());
+        std::memset(buffer.storage.get() + str.length(), 0, padding);
+        return buffer;
+    }
+
+    const char* data() const {
+        return storage.get();
+    }
+
+    size_t size() const {
+        return length;
+    }
+};
+
+// Per UTF8 lead byte, everything needed to decode and validate its sequence
+// from one entry. 0xc0, 0xc1 and 0xf5-0xf7 get a length, so their sequences
+// decode and then fail as overlong or too large.
+struct utf8_lead {
+    uint32_t min_code;      // Smaller code points are overlong
+    uint32_t trailing_bits; // Top two bits of the trailing bytes, in a little endian word of the sequence
+    uint8_t length;         // 0 if the byte cannot start a sequence
+    uint8_t mask;           // Payload bits of the lead byte
+};
+
+constexpr std::array<utf8_lead, 256> make_utf8_lead_table() {
+    std::array<utf8_lead, 256> table = {};
+    for (size_t byte = 0xc0; byte < 0xf8; byte++) {
+        if (byte < 0xe0)
+            table[byte] = {0x80, 0xc000, 2, 0x1f};
+        else if (byte < 0xf0)
+            table[byte] = {0x800, 0xc0c000, 3, 0x0f};
+        else
+            table[byte] = {0x10000, 0xc0c0c000, 4, 0x07};
+    }
+    return table;
+}
+
+constexpr std::array<utf8_lead, 256> utf8_lead_table = make_utf8_lead_table();
+
+// Scans a buffer of CharT code units in place. UTF16 surrogate pairs are
+// decoded on the fly and UTF32 code points are looked up directly, so wide
+// input needs no transcoding pass.
+template <typename CharT>
+struct basic_tokenizer {
+    static_assert(sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4, "unsupported code unit");
+
+    using token = basic_token<CharT>;
+
+    const CharT* position = nullptr;
+    const CharT* const end = nullptr;
     size_t current_char_length = 0;
 
     size_t column = 0; // Optimization(sorgre): Only needed for setting column data inside tokens.
 
-    static tokenizer from_string(const std::string &str) {
-        return {str.data(), str.data() + str.length(), 1, 1};
+    // Merge each run of invalid UTF8 bytes into a single bad_char_kind token,
+    // instead of one token per bad sequence.
+    bool coalesce_bad_bytes = false;
+    typename token::error_type current_char_error = token::no_error;
+
+    // Number of readable code units after `end` that cannot be part of a
+    // token, like zero padding or the '\n' ending a line. With at least one,
+    // that unit stops every run by itself, and the end is only checked
+    // between tokens.
+    size_t padding = 0;
+
+    // Last range of each identifier table that matched, tried before the
+    // table. Consecutive identifier characters nearly always come from one
+    // script, and so from one range.
+    struct unicode_range {
+        uint32_t first = 1; // Empty until a lookup matches
+        uint32_t last = 0;
+    };
+    unicode_range recent_id_start = {};
+    unicode_range recent_id_continue = {};
+
+    static basic_tokenizer from_string(const std::basic_string<CharT> &str) {
+        // std::basic_string always has a terminating zero after its data.
+        basic_tokenizer result = {str.data(), str.data() + str.length(), 1, 1};
+        result.padding = 1;
+        return result;
+    }
+
+    // A line inside a larger buffer, followed by its (still readable) '\n'.
+    static basic_tokenizer from_line(std::basic_string_view<CharT> line) {
+        assert(line.data()[line.length()] == '\n' || line.data()[line.length()] == '\0');
+        basic_tokenizer result = {line.data(), line.data() + line.length(), 1, 1};
+        result.padding = 1;
+        return result;
+    }
+
+    // Only for char: padded_buffer holds bytes.
+    static basic_tokenizer from_buffer(const padded_buffer &buffer) {
+        basic_tokenizer result = {buffer.data(), buffer.data() + buffer.size(), 1, 1};
+        result.padding = padded_buffer::padding;
+        return result;
+    }
+
+    // Scanning state without the (constant) buffer end. Trivially copyable,
+    // so saving and restoring it is a few word copies.
+    struct checkpoint {
+        const CharT* position;
+        size_t current_char_length;
+        size_t column;
+    };
+
+    checkpoint save() const {
+        return {position, current_char_length, column};
+    }
+
+    void restore(const checkpoint &saved) {
+        assert(saved.position <= end);
+        position = saved.position;
+        current_char_length = saved.current_char_length;
+        column = saved.column;
     }
 
-    bool not_at_end() {
+    TOKENIZER_CONSTEXPR bool not_at_end() {
         assert(position <= end);
         return position < end;
     }
     
-    char current_char(int offset = 0) {
-        assert(position + offset < end);
+    TOKENIZER_CONSTEXPR CharT current_char(int offset = 0) {
+        assert(position + offset < end + padding);
         return position[offset];
     }
     
-    void consume_current() {
+    TOKENIZER_CONSTEXPR void consume_current() {
         assert(position + current_char_length <= end);
         position += current_char_length;
         column++;
         current_char_length = 1;
     }
     
-    bool consume_numeric() {
-        assert(position < end);
+    TOKENIZER_CONSTEXPR bool consume_numeric() {
+        assert(position < end + padding);
         if (current_char() >= '0' && current_char() <= '9') {
+            TOKENIZER_STAT_ADD(stat_ascii_fast_path, 1);
             consume_current();
             return true;
         }
         return false;
     }
 
-    bool consume_alpha() {
+    TOKENIZER_CONSTEXPR bool consume_alpha() {
         if (
             (current_char() >= 'a' && current_char() <= 'z') ||
             (current_char() >= 'A' && current_char() <= 'Z') ||
             (current_char() == '_')
         ) {
+            TOKENIZER_STAT_ADD(stat_ascii_fast_path, 1);
             consume_current();
             return true;
         }
         return false;
     }
 
-    template <int N>
-    bool consume_good_utf8(const uint32_t (&unicode_table)[N][2]) {
-        // multibyte test: 0b1xxxxxxx;
-        static const uint8_t UTF8_MULTIBYTE_MASK = 0x80;  // 0b10000000;
+    // multibyte test: 0b1xxxxxxx;
+    static const uint8_t UTF8_MULTIBYTE_MASK = 0x80;  // 0b10000000;
 
-        // 4-byte test: 0b11110xxx;
-        static const uint8_t UTF8_4BYTE_MASK = 0xf8;  // 0b11111000;
-        static const uint8_t UTF8_4BYTE_MASK_INV = 0x07;  // 0b00000111;
-        static const uint8_t UTF8_4BYTE_TEST = 0xf0;  // 0b11110000;
+    // trailing byte test: 0b10xxxxxx;
+    static const uint8_t UTF8_NEXT_BYTE_TEST_MASK = 0xc0;  // 0b11000000;
+    static const uint8_t UTF8_NEXT_BYTE_TEST = 0x80;  // 0b10000000;
+    static const uint8_t UTF8_NEXT_BYTE_MASK = 0x3f;  // 0b00111111;
 
-        // 3-byte test: 0b1110xxxx;
-        static const uint8_t UTF8_3BYTE_MASK = 0xf0;  // 0b11110000;
-        static const uint8_t UTF8_3BYTE_MASK_INV = 0x0f;  // 0b00001111;
-        static const uint8_t UTF8_3BYTE_TEST = 0xe0;  // 0b11100000;
+    // Decodes the UTF8 sequence at the current position without reading past
+    // `end`. On failure, current_char_length covers the bad bytes (at least
+    // one) and current_char_error tells why.
+    TOKENIZER_CONSTEXPR bool decode_utf8(uint32_t &code) {
+        const utf8_lead lead = utf8_lead_table[uint8_t(current_char())];
+        if (lead.length == 0) {
+            current_char_length = 1;
+            current_char_error = token::bad_lead_byte;
+            return false;
+        }
 
-        // 2-byte test: 0b110xxxxx;
-        static const uint8_t UTF8_2BYTE_MASK = 0xe0;  // 0b11100000;
-        static const uint8_t UTF8_2BYTE_MASK_INV = 0x1f;  // 0b00001111;
-        static const uint8_t UTF8_2BYTE_TEST = 0xc0;  // 0b11000000;
+        // Bytes from the current position that belong to the sequence: the
+        // lead and the trailing bytes after it, never past `end`.
+        size_t available = end - position;
+        size_t valid = 1;
+        if (!constant_evaluation() && available + padding >= 4) {
+            // Optimization(sorgre): One load and fixed shifts decode every
+            // length; the bytes after the sequence are shifted out.
+            uint32_t word = 0;
+            std::memcpy(&word, position, 4);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            word = __builtin_bswap32(word);
+#endif
+            code = ((word & lead.mask) << 18) | ((word & 0x3f00) << 4) | ((word >> 10) & 0xfc0) | ((word >> 24) & 0x3f);
+            code >>= 6 * (4 - lead.length);
+            if ((word & lead.trailing_bits) == (0x80808080 & lead.trailing_bits) && available >= lead.length) {
+                valid = lead.length;
+            }
+            else {
+                uint32_t not_trailing = ((word & 0xc0c0c0c0) ^ 0x80808080) & 0xffffff00;
+                valid = std::min<size_t>(not_trailing != 0 ? __builtin_ctz(not_trailing) / 8 : 4, available);
+            }
+        }
+        else {
+            size_t readable = std::min<size_t>(lead.length, available);
+            code = uint8_t(current_char()) & lead.mask;
+            for (; valid < readable; valid++) {
+                uint8_t next = current_char(valid);
+                if ((next & UTF8_NEXT_BYTE_TEST_MASK) != UTF8_NEXT_BYTE_TEST)
+                    break;
+                code = (code << 6) | (next & UTF8_NEXT_BYTE_MASK);
+            }
+        }
 
-        static const uint8_t UTF8_NEXT_BYTE_MASK = 0x3f;  // 0b00111111;
+        if (valid < lead.length) {
+            current_char_length = valid;
+            current_char_error = valid == available ? token::missing_trailing_bytes : token::bad_trailing_byte;
+            return false;
+        }
+        // Optimization(sorgre): A branch per length instead of assigning
+        // lead.length, so the next position is predicted rather than waiting
+        // on the table load. Runs of one script predict perfectly.
+        switch (lead.length) {
+            case 2: current_char_length = 2; break;
+            case 3: current_char_length = 3; break;
+            default: current_char_length = 4; break;
+        }
+        if (code < lead.min_code)
+            current_char_error = token::overlong_encoding;
+        else if (code >= 0xd800 && code <= 0xdfff)
+            current_char_error = token::surrogate_code_point;
+        else if (code > 0x10ffff)
+            current_char_error = token::code_point_too_large;
+        else
+            return true;
+        return false;
+    }
 
-        if (!(current_char() & UTF8_MULTIBYTE_MASK))
+    // Decodes a surrogate pair, or a single unit outside the surrogates.
+    TOKENIZER_CONSTEXPR bool decode_utf16(uint32_t &code) {
+        code = uint32_t(current_char());
+        current_char_length = 1;
+        if (code < 0xd800 || code > 0xdfff)
+            return true;
+        if (code <= 0xdbff && end - position >= 2) {
+            uint32_t low = uint32_t(current_char(1));
+            if (low >= 0xdc00 && low <= 0xdfff) {
+                code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                current_char_length = 2;
+                return true;
+            }
+        }
+        current_char_error = token::unpaired_surrogate;
+        return false;
+    }
+
+    TOKENIZER_CONSTEXPR bool decode_utf32(uint32_t &code) {
+        code = uint32_t(current_char());
+        current_char_length = 1;
+        if (code >= 0xd800 && code <= 0xdfff)
+            current_char_error = token::surrogate_code_point;
+        else if (code > 0x10ffff)
+            current_char_error = token::code_point_too_large;
+        else
+            return true;
+        return false;
+    }
+
+    TOKENIZER_CONSTEXPR bool decode(uint32_t &code) {
+        if constexpr (sizeof(CharT) == 1)
+            return decode_utf8(code);
+        else if constexpr (sizeof(CharT) == 2)
+            return decode_utf16(code);
+        else
+            return decode_utf32(code);
+    }
+
+    // True for code units that are not plain ASCII: UTF8 lead and trailing
+    // bytes, and every wide unit above 0x7f.
+    static constexpr bool is_multi_unit(CharT unit) {
+        return std::make_unsigned_t<CharT>(unit) >= UTF8_MULTIBYTE_MASK;
+    }
+
+    template <int N>
+    TOKENIZER_CONSTEXPR bool consume_good_utf8(const uint32_t (&unicode_table)[N][2], unicode_range &recent) {
+        if (!is_multi_unit(current_char()))
             return false;
 
+        TOKENIZER_STAT_ADD(stat_utf8_slow_path, 1);
+        TOKENIZER_PROBE2(utf8_slow_path, position, column);
         uint32_t code = 0;
-        if ((current_char() & UTF8_4BYTE_MASK) == UTF8_4BYTE_TEST) {
-            if (end - position < 4) {
-                std::cerr << "UTF8 string error: missing trailing bytes" << std::endl;
-            }
-            uint32_t b0 = (current_char(0) & UTF8_4BYTE_MASK_INV) << 18;
-            uint32_t b1 = (current_char(1) & UTF8_NEXT_BYTE_MASK) << 12;
-            uint32_t b2 = (current_char(2) & UTF8_NEXT_BYTE_MASK) << 6;
-            uint32_t b3 = (current_char(3) & UTF8_NEXT_BYTE_MASK) << 0;
-            code = b0 | b1 | b2 | b3;
-            current_char_length = 4;
-        }
-        else if ((current_char() & UTF8_3BYTE_MASK) == UTF8_3BYTE_TEST) {
-            if (end - position < 3) {
-                std::cerr << "UTF8 string error: missing trailing bytes" << std::endl;
-            }
-            uint32_t b0 = (current_char(0) & UTF8_3BYTE_MASK_INV) << 12;
-            uint32_t b1 = (current_char(1) & UTF8_NEXT_BYTE_MASK) << 6;
-            uint32_t b2 = (current_char(2) & UTF8_NEXT_BYTE_MASK) << 0;
-            code = b0 | b1 | b2;
-            current_char_length = 3;
-        }
-        else if ((current_char() & UTF8_2BYTE_MASK) == UTF8_2BYTE_TEST) {
-            if (end - position < 2) {
-                std::cerr << "UTF8 string error: missing trailing bytes" << std::endl;
-            }
-            uint32_t b0 = (current_char(0) & UTF8_2BYTE_MASK_INV) << 6;
-            uint32_t b1 = (current_char(1) & UTF8_NEXT_BYTE_MASK) << 0;
-            code = b0 | b1;
-            current_char_length = 2;
+        if (!decode(code)) {
+            TOKENIZER_STAT_ADD(stat_utf8_errors, 1);
+            return false;
         }
-        else {
-            std::cerr << "UTF8 string error: bad code point '" << current_char() << "'" << std::endl;
+
+        if (code >= recent.first && code <= recent.last) {
+            TOKENIZER_STAT_ADD(stat_table_memo_hits, 1);
+            consume_current();
+            return true;
         }
-        
+
+        TOKENIZER_STAT_ADD(stat_table_lookups, 1);
         for (size_t i = 0; i < N; i++) {
             if (code >= unicode_table[i][0] && code <= unicode_table[i][1]) {
+                TOKENIZER_STAT_ADD(stat_table_range_steps, i + 1);
+                recent = {unicode_table[i][0], unicode_table[i][1]};
                 consume_current();
                 return true;
             }
         }
 
+        TOKENIZER_STAT_ADD(stat_table_range_steps, N);
         return false;
     }
 
-    token next_token() {
+    // Skips the rest of a run of invalid UTF8. Bytes that can never start a
+    // sequence (trailing bytes, 0xc0, 0xc1, 0xf5-0xff) are skipped without
+    // decoding, so garbage input goes by at close to memchr speed. Wide
+    // units are decoded one by one.
+    TOKENIZER_CONSTEXPR void consume_bad_utf8_run() {
+        while (not_at_end()) {
+            if constexpr (sizeof(CharT) == 1) {
+                size_t run = 0;
+                if (constant_evaluation()) {
+                    while (position + run < end && in_byte_class<non_lead_bytes>(uint8_t(position[run])))
+                        run++;
+                }
+                else {
+                    run = simd().non_lead_run(reinterpret_cast<const char*>(position), end - position);
+                }
+                TOKENIZER_STAT_ADD(stat_utf8_errors, run);
+                position += run;
+                column += run;
+            }
+            current_char_length = 1;
+            if (!not_at_end() || !is_multi_unit(current_char()))
+                return;
+            uint32_t code = 0;
+            if (decode(code)) {
+                current_char_length = 1;
+                return;
+            }
+            TOKENIZER_STAT_ADD(stat_utf8_errors, 1);
+            consume_current();
+        }
+    }
+
+    // Skips a run of ASCII identifier characters with the vector kernel.
+    TOKENIZER_CONSTEXPR void consume_identifier_run() {
+        if constexpr (sizeof(CharT) == 1) {
+            if (constant_evaluation())
+                return;
+            // Optimization(sorgre): Below a vector width the call costs more than
+            // the byte loop it replaces.
+            size_t remaining = end - position;
+            if (remaining < 16)
+                return;
+            size_t run = simd().identifier_run(reinterpret_cast<const char*>(position), remaining);
+            TOKENIZER_STAT_ADD(stat_ascii_fast_path, run);
+            position += run;
+            column += run;
+        }
+    }
+
+    // Counts a token handed out by next_token_of and the bytes scanned for it.
+    TOKENIZER_CONSTEXPR void count_token(typename token::kind_type kind, const CharT* scan_start) {
+        TOKENIZER_STAT_ADD(stat_bytes_scanned, (position - scan_start) * sizeof(CharT));
+        TOKENIZER_STAT_ADD(stat_tokens + size_t(kind), 1);
+        TOKENIZER_PROBE3(next_token_exit, kind, scan_start, position - scan_start);
+    }
+
+    TOKENIZER_CONSTEXPR token next_token() {
+        if (padding != 0)
+            return next_token_of<token::all_kinds_mask, true>();
+        return next_token_of<token::all_kinds_mask, false>();
+    }
+
+    // Like next_token, but tokens whose kind is not in `Mask` are scanned past
+    // without being returned. The end of line token is always returned.
+    // `Padded` scanning relies on the zero byte after `end` to stop runs.
+    template <typename token::kind_mask Mask, bool Padded = false>
+    TOKENIZER_CONSTEXPR token next_token_of() {
+        assert(!Padded || padding != 0);
+
+        constexpr auto wanted = [](typename token::kind_type kind) {
+            return (Mask & token::mask_of(kind)) != 0;
+        };
+        const CharT* scan_start = position;
+        TOKENIZER_PROBE2(next_token_entry, position, end - position);
+
         while (not_at_end()) {
 
             token current_token = {
@@ -189,62 +569,229 @@ struct tokenizer {
                 case '*':
                 case '/':
                 case '=':
-                    current_token.kind = token::punctuation_kind;
                     consume_current();
+                    if (!wanted(token::punctuation_kind))
+                        continue;
+                    current_token.kind = token::punctuation_kind;
+                    count_token(current_token.kind, scan_start);
                     return current_token;
             }
 
             // Number literal
-            while (consume_numeric() && not_at_end());
+            while (consume_numeric() && (Padded || not_at_end()));
             // Number literal, decimal/fractional part
-            if (not_at_end() && current_char() == '.') {
+            if ((Padded || not_at_end()) && current_char() == '.') {
                 consume_current();
-                while (not_at_end() && consume_numeric());
+                while ((Padded || not_at_end()) && consume_numeric());
             }
 
             if (current_token.position != position) {
                 // Number literal has been parsed
+                if (!wanted(token::number_kind))
+                    continue;
                 current_token.kind = token::number_kind;
                 current_token.length = position - current_token.position;
                 current_token.column_length = column - current_token.column;
+                count_token(current_token.kind, scan_start);
                 return current_token;
             }
 
             // identifier
             current_char_length = 1;
+            current_char_error = token::no_error;
             if (
-                not_at_end() && (
+                (Padded || not_at_end()) && (
                     consume_alpha() ||
-                    consume_good_utf8(id_start_table)
+                    consume_good_utf8(id_start_table, recent_id_start)
                 )
-            )
+            ) {
+                consume_identifier_run();
                 while (
-                    not_at_end() && (
+                    (Padded || not_at_end()) && (
                         consume_alpha() ||
                         consume_numeric() ||
-                        consume_good_utf8(id_continue_table)
+                        consume_good_utf8(id_continue_table, recent_id_continue)
                     )
                 );
+            }
 
             if (current_token.position != position) {
                 // Identifier has been parsed
+                if (!wanted(token::symbol_kind))
+                    continue;
                 current_token.kind = token::symbol_kind;
                 current_token.length = position - current_token.position;
                 current_token.column_length = column - current_token.column;
+                count_token(current_token.kind, scan_start);
                 return current_token;
             }
 
-            current_token.kind = token::bad_char_kind;
-            current_token.length = current_char_length;
-            std::cout << current_token << std::endl;
+            TOKENIZER_STAT_ADD(stat_bad_chars, 1);
+            current_token.error = current_char_error;
             consume_current();
+            if (coalesce_bad_bytes && current_token.error != token::no_error)
+                consume_bad_utf8_run();
+            TOKENIZER_PROBE3(bad_char, current_token.position, position - current_token.position, current_token.error);
+            if (!wanted(token::bad_char_kind))
+                continue;
+            current_token.kind = token::bad_char_kind;
+            current_token.length = position - current_token.position;
+            current_token.column_length = column - current_token.column;
+            count_token(current_token.kind, scan_start);
             return current_token;
         };
 
+        count_token(token::eol_kind, scan_start);
+        TOKENIZER_PROBE2(buffer_done, position, column);
         return {
                 token::eol_kind,
                 position, 1,
                 column, 1
         };
     }
-};
\ No newline at end of file
+};
+
+using tokenizer = basic_tokenizer<char>;
+
+// Push-based tokenization: calls `visitor(tkn)` for every token whose kind is
+// in `Mask`. Other kinds are skipped inside the scanner and never built. The
+// visitor is a template parameter, so a lambda handler inlines into the scan.
+template <token::kind_mask Mask, bool Padded, typename CharT, typename Visitor>
+void tokenize_scan(basic_tokenizer<CharT> &tokenizer, Visitor &visitor) {
+    using token = basic_token<CharT>;
+    while (true) {
+        auto next_token = tokenizer.template next_token_of<Mask, Padded>();
+        if (next_token.kind == token::eol_kind) {
+            if (Mask & token::mask_of(token::eol_kind))
+                visitor(next_token);
+            return;
+        }
+        visitor(next_token);
+    }
+}
+
+template <token::kind_mask Mask = token::all_kinds_mask, typename CharT, typename Visitor>
+void tokenize(basic_tokenizer<CharT> &tokenizer, Visitor &&visitor) {
+    if (tokenizer.padding != 0)
+        tokenize_scan<Mask, true>(tokenizer, visitor);
+    else
+        tokenize_scan<Mask, false>(tokenizer, visitor);
+}
+
+template <token::kind_mask Mask = token::all_kinds_mask, typename CharT, typename Visitor>
+void tokenize(const std::basic_string<CharT> &buffer, Visitor &&visitor) {
+    auto tokenizer = basic_tokenizer<CharT>::from_string(buffer);
+    tokenize<Mask>(tokenizer, visitor);
+}
+
+// Lookahead and backtracking on top of a tokenizer. The last N lexed tokens
+// are kept in a ring buffer, so peek(k) for k < N lexes at most k tokens, and
+// restoring a checkpoint inside the ring is O(1) with no re-lexing. Older
+// checkpoints fall back to restoring the scanner state.
+template <size_t N = 8, typename CharT = char>
+struct token_stream {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+    using tokenizer = basic_tokenizer<CharT>;
+    using token = basic_token<CharT>;
+
+    struct checkpoint {
+        uint64_t ordinal;
+        typename tokenizer::checkpoint before;
+    };
+
+    struct lexed_token {
+        token tkn;
+        typename tokenizer::checkpoint before;
+    };
+
+    tokenizer scanner;
+    lexed_token ring[N] = {};
+    uint64_t first_lexed = 0; // Oldest ordinal that may still be in the ring
+    uint64_t lexed = 0;       // Ordinal of the next token to be lexed
+    uint64_t cursor = 0;      // Ordinal of the next token to be returned
+
+    explicit token_stream(const tokenizer &scanner) : scanner(scanner) {}
+
+    const token &peek(size_t k = 0) {
+        assert(k < N);
+        while (lexed <= cursor + k) {
+            auto &entry = ring[lexed % N];
+            entry.before = scanner.save();
+            entry.tkn = scanner.next_token();
+            lexed++;
+        }
+        return ring[(cursor + k) % N].tkn;
+    }
+
+    token next() {
+        token tkn = peek();
+        cursor++;
+        return tkn;
+    }
+
+    checkpoint save() const {
+        if (cursor < lexed)
+            return {cursor, ring[cursor % N].before};
+        return {cursor, scanner.save()};
+    }
+
+    void restore(const checkpoint &saved) {
+        uint64_t oldest = lexed > N ? lexed - N : 0;
+        if (saved.ordinal >= first_lexed && saved.ordinal >= oldest && saved.ordinal <= lexed) {
+            cursor = saved.ordinal;
+            return;
+        }
+        scanner.restore(saved.before);
+        first_lexed = lexed = cursor = saved.ordinal;
+    }
+};
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+// A string literal as a template argument: tokenize<"a + b">().
+template <size_t N>
+struct fixed_string {
+    char data[N] = {};
+
+    constexpr fixed_string(const char (&text)[N]) {
+        for (size_t i = 0; i < N; i++)
+            data[i] = text[i];
+    }
+
+    constexpr size_t size() const {
+        return N - 1;
+    }
+};
+
+// Tokens of `Text`, end of line token included, computed by the compiler.
+// Their spellings point into the template argument, which has static storage,
+// so the result can be a constexpr variable. A bad character fails to compile,
+// whether the call is constant evaluated or not.
+template <fixed_string Text>
+constexpr auto tokenize() {
+    struct literal_scan {
+        size_t count = 1;
+        bool valid = true;
+    };
+    constexpr literal_scan scan = [] {
+        // The terminating zero of `Text` is the padding.
+        tokenizer scanner = {Text.data, Text.data + Text.size(), 1, 1};
+        scanner.padding = 1;
+        literal_scan result;
+        for (token tkn = scanner.next_token(); tkn.kind != token::eol_kind; tkn = scanner.next_token()) {
+            result.count++;
+            if (tkn.kind == token::bad_char_kind)
+                result.valid = false;
+        }
+        return result;
+    }();
+    static_assert(scan.valid, "bad character in token literal");
+
+    std::array<token, scan.count> result;
+    tokenizer scanner = {Text.data, Text.data + Text.size(), 1, 1};
+    scanner.padding = 1;
+    for (auto &tkn : result)
+        tkn = scanner.next_token();
+    return result;
+}
+#endif